@@ -92,6 +92,17 @@ else
    echo '   'Build internal ANN library. : yes
 fi
 
+if test "x$OPENMP_CXXFLAGS" = "x"; then
+   echo '   'Enable OpenMP threading.... : no
+else
+   echo '   'Enable OpenMP threading.... : yes
+fi
+if test "x$acx_pthread_ok" = "xyes"; then
+   echo '   'Enable POSIX threads....... : yes
+else
+   echo '   'Enable POSIX threads....... : no
+fi
+
 # Paths for optional packages which are enabled
 
 echo 
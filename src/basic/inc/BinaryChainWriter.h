@@ -0,0 +1,118 @@
+//-----------------------------------------------------------------------bl-
+//--------------------------------------------------------------------------
+//
+// QUESO - a library to support the Quantification of Uncertainty
+// for Estimation, Simulation and Optimization
+//
+// Copyright (C) 2008-2015 The PECOS Development Team
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the Version 2.1 GNU Lesser General
+// Public License as published by the Free Software Foundation.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc. 51 Franklin Street, Fifth Floor,
+// Boston, MA  02110-1301  USA
+//
+//-----------------------------------------------------------------------el-
+
+#ifndef UQ_BINARY_CHAIN_WRITER_H
+#define UQ_BINARY_CHAIN_WRITER_H
+
+#include <queso/Defines.h>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#ifdef QUESO_HAVE_PTHREAD
+#include <pthread.h>
+#endif
+
+#define UQ_BINARY_CHAIN_MAGIC      "QUESOCHN"
+#define UQ_BINARY_CHAIN_MAGIC_SIZE 8
+
+// Records per block when the caller has no natural block size
+#define UQ_BINARY_CHAIN_DEFAULT_BLOCK_SIZE 4096
+
+namespace QUESO {
+
+/*!
+ * \file BinaryChainWriter.h
+ * \brief Streams chain records to a raw binary file.
+ *
+ * \class BinaryChainWriter
+ * \brief Appends fixed-width records of doubles to a raw binary file.
+ *
+ * The file holds a magic string and the record size (an 8-byte unsigned integer), followed
+ * by the records in native byte order. Records are copied into a front buffer; once the
+ * buffer holds \c blockSize records it is swapped with a back buffer that a background
+ * thread writes to the file, so the caller only pays for the copy. Without POSIX threads
+ * the full buffer is written by the caller.
+ */
+class BinaryChainWriter
+{
+public:
+  //! Creates (or truncates) \c fileName, for records of \c recordSize doubles written in blocks of \c blockSize records.
+  BinaryChainWriter(const std::string& fileName,
+                    unsigned int       recordSize,
+                    unsigned int       blockSize);
+
+  //! Destructor. Writes whatever is buffered and closes the file.
+  ~BinaryChainWriter();
+
+  //! Number of doubles per record.
+  unsigned int recordSize() const;
+
+  //! Appends the \c numRecords records stored contiguously at \c records.
+  void append(const double* records, unsigned int numRecords);
+
+  //! Returns once every record appended so far is in the file.
+  void flush();
+
+  //! Reads a file written by this class.
+  /*! On return, \c records holds the records back to back, each of \c recordSize doubles. */
+  static void read(const std::string&   fileName,
+                   unsigned int&        recordSize,
+                   std::vector<double>& records);
+
+private:
+  //! Hands the front buffer to the I/O thread (or writes it, without threads).
+  void submit();
+
+  //! Writes the first \c numValues values of \c block to the file.
+  void writeBlock(const std::vector<double>& block, size_t numValues);
+
+#ifdef QUESO_HAVE_PTHREAD
+  //! Entry point of the I/O thread.
+  static void* ioThreadEntry(void* writer);
+
+  //! Writes back buffers until told to stop.
+  void ioThreadLoop();
+#endif
+
+  std::FILE*          m_file;
+  unsigned int        m_recordSize;
+  std::vector<double> m_frontBuffer;
+  size_t              m_frontValues;
+  std::vector<double> m_backBuffer;
+  size_t              m_backValues;
+  bool                m_writeFailed;
+
+#ifdef QUESO_HAVE_PTHREAD
+  pthread_t           m_thread;
+  pthread_mutex_t     m_mutex;
+  pthread_cond_t      m_cond;
+  bool                m_backBusy;
+  bool                m_stop;
+#endif
+};
+
+}  // End namespace QUESO
+
+#endif // UQ_BINARY_CHAIN_WRITER_H
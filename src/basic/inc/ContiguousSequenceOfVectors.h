@@ -0,0 +1,331 @@
+//-----------------------------------------------------------------------bl-
+//--------------------------------------------------------------------------
+//
+// QUESO - a library to support the Quantification of Uncertainty
+// for Estimation, Simulation and Optimization
+//
+// Copyright (C) 2008-2015 The PECOS Development Team
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the Version 2.1 GNU Lesser General
+// Public License as published by the Free Software Foundation.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc. 51 Franklin Street, Fifth Floor,
+// Boston, MA  02110-1301  USA
+//
+//-----------------------------------------------------------------------el-
+
+#ifndef UQ_CONTIGUOUS_SEQUENCE_OF_VECTORS_H
+#define UQ_CONTIGUOUS_SEQUENCE_OF_VECTORS_H
+
+#include <queso/VectorSequence.h>
+
+namespace QUESO {
+
+class GslVector;
+class GslMatrix;
+
+/*! \file ContiguousSequenceOfVectors.h
+ * \brief A templated class for handling vector samples stored in one contiguous buffer
+ *
+ * \class ContiguousSequenceOfVectors
+ * \brief Class for handling vector samples stored parameter by parameter.
+ *
+ * This class offers the same functionality as SequenceOfVectors<V,M>, but instead of
+ * keeping one heap allocated vector per position, it keeps all positions in a single
+ * buffer, stored column-major: the values of parameter \c i for all positions are
+ * contiguous in memory. Setting a position therefore never allocates, and statistics,
+ * scalar sequence extraction and file output become streaming passes over contiguous
+ * memory. It is derived from and implements BaseVectorSequence<V,M>.
+ *
+ * The optional methods guarded by QUESO_COMPUTES_EXTRA_POST_PROCESSING_STATISTICS,
+ * UQ_ALSO_COMPUTE_MDFS_WITHOUT_KDE and UQ_CODE_HAS_MONITORS are not provided. */
+
+template <class V = GslVector, class M = GslMatrix>
+class ContiguousSequenceOfVectors : public BaseVectorSequence<V,M>
+{
+public:
+  //! @name Constructor/Destructor methods
+  //@{
+  //! Default constructor.
+  ContiguousSequenceOfVectors(const VectorSpace<V,M>& vectorSpace,
+                              unsigned int            subSequenceSize,
+                              const std::string&      name);
+  //! Destructor.
+  ~ContiguousSequenceOfVectors();
+  //@}
+
+  //! @name Set methods
+  //@{
+  //! Copies values from \c rhs to \c this.
+  ContiguousSequenceOfVectors<V,M>& operator= (const ContiguousSequenceOfVectors<V,M>& rhs);
+  //@}
+
+  //! @name Sequence methods
+  //@{
+  //! Size of the sub-sequence of vectors.
+  unsigned int  subSequenceSize            () const;
+
+  //! Resizes the sequence.
+  /*! Values of the first min(old size, new size) positions are kept, new positions are
+   * set to zero. This routine deletes all stored computed vectors */
+  void          resizeSequence             (unsigned int newSubSequenceSize);
+
+  //! Resets (to zero) a total of \c numPos values of the sequence starting at position \c initialPos.
+  /*! This routine deletes all stored computed vectors */
+  void          resetValues                (unsigned int initialPos, unsigned int numPos);
+
+  //! Erases \c numPos elements of the sequence starting at position \c initialPos.
+  /*! This routine deletes all stored computed vectors */
+  void          erasePositions             (unsigned int initialPos, unsigned int numPos);
+
+  //! Gets the values of the sequence at position \c posId and stores them at \c vec.
+  void          getPositionValues          (unsigned int posId,       V& vec) const;
+
+  //! Set the values in \c vec at position \c posId of the sequence.
+  /*! This routine deletes all stored computed vectors */
+  void          setPositionValues          (unsigned int posId, const V& vec);
+
+  //! View of the values of parameter \c paramId, for all positions of the sub-sequence.
+  /*! The returned pointer addresses subSequenceSize() contiguous values. It is invalidated
+   * by any method that changes the size of the sequence. */
+  const double* paramValues                (unsigned int paramId) const;
+
+  //! Finds the mean value of the sub-sequence, considering \c numPos positions starting at position \c initialPos.
+  void          subMeanExtra               (unsigned int                         initialPos,
+                                            unsigned int                         numPos,
+                                            V&                                   meanVec) const;
+
+  //! Finds the mean value of the unified sequence, considering \c numPos positions starting at position \c initialPos.
+  void          unifiedMeanExtra           (unsigned int                         initialPos,
+                                            unsigned int                         numPos,
+                                            V&                                   unifiedMeanVec) const;
+
+  //! Finds the median value of the sub-sequence, considering \c numPos positions starting at position \c initialPos.
+  void          subMedianExtra             (unsigned int                         initialPos,
+                                            unsigned int                         numPos,
+                                            V&                                   medianVec) const;
+
+  //! Finds the median value of the unified sequence, considering \c numPos positions starting at position \c initialPos.
+  void          unifiedMedianExtra         (unsigned int                         initialPos,
+                                            unsigned int                         numPos,
+                                            V&                                   unifiedMedianVec) const;
+
+  //! Finds the sample variance of the sub-sequence, considering \c numPos positions starting at position \c initialPos and of mean \c meanVec.
+  void          subSampleVarianceExtra     (unsigned int                         initialPos,
+                                            unsigned int                         numPos,
+                                            const V&                             meanVec,
+                                            V&                                   samVec) const;
+
+  //! Finds the sample variance of the unified sequence, considering \c numPos positions starting at position \c initialPos and of mean \c meanVec.
+  void          unifiedSampleVarianceExtra (unsigned int                         initialPos,
+                                            unsigned int                         numPos,
+                                            const V&                             unifiedMeanVec,
+                                            V&                                   unifiedSamVec) const;
+
+  //! Finds the sample standard deviation of the sub-sequence, considering \c numPos positions starting at position \c initialPos and of mean \c meanVec.
+  void          subSampleStd               (unsigned int                         initialPos,
+                                            unsigned int                         numPos,
+                                            const V&                             meanVec,
+                                            V&                                   stdVec) const;
+
+  //! Finds the sample standard deviation of the unified sequence, considering \c numPos positions starting at position \c initialPos and of mean \c meanVec.
+  void          unifiedSampleStd           (unsigned int                         initialPos,
+                                            unsigned int                         numPos,
+                                            const V&                             unifiedMeanVec,
+                                            V&                                   unifiedStdVec) const;
+
+  //! Finds the population variance of the sub-sequence, considering \c numPos positions starting at position \c initialPos and of mean \c meanVec.
+  void          subPopulationVariance      (unsigned int                         initialPos,
+                                            unsigned int                         numPos,
+                                            const V&                             meanVec,
+                                            V&                                   popVec) const;
+
+  //! Finds the population variance of the unified sequence, considering \c numPos positions starting at position \c initialPos and of mean \c meanVec.
+  void          unifiedPopulationVariance  (unsigned int                         initialPos,
+                                            unsigned int                         numPos,
+                                            const V&                             unifiedMeanVec,
+                                            V&                                   unifiedPopVec) const;
+
+  //! Calculates the autocovariance, with a lag of \c lag and mean given by \c meanVec.
+  void          autoCovariance             (unsigned int                         initialPos,
+                                            unsigned int                         numPos,
+                                            const V&                             meanVec,
+                                            unsigned int                         lag,
+                                            V&                                   covVec) const;
+
+  //! Calculates the autocorrelation via definition.
+  void          autoCorrViaDef             (unsigned int                         initialPos,
+                                            unsigned int                         numPos,
+                                            unsigned int                         lag,
+                                            V&                                   corrVec) const;
+
+  //! Calculates the autocorrelation via Fast Fourier transforms (FFT).
+  void          autoCorrViaFft             (unsigned int                         initialPos,
+                                            unsigned int                         numPos,
+                                            const std::vector<unsigned int>&     lags,
+                                            std::vector<V*>&                     corrVecs) const;
+
+  //! Calculates the autocorrelation via Fast Fourier transforms (FFT).
+  void          autoCorrViaFft             (unsigned int                         initialPos,
+                                            unsigned int                         numPos,
+                                            unsigned int                         numSum,
+                                            V&                                   autoCorrsSumVec) const;
+
+  //! Finds the minimum and the maximum values of the sub-sequence, considering \c numPos positions starting at position \c initialPos.
+  void          subMinMaxExtra             (unsigned int                         initialPos,
+                                            unsigned int                         numPos,
+                                            V&                                   minVec,
+                                            V&                                   maxVec) const;
+
+  //! Finds the minimum and the maximum values of the unified sequence, considering \c numPos positions starting at position \c initialPos.
+  void          unifiedMinMaxExtra         (unsigned int                         initialPos,
+                                            unsigned int                         numPos,
+                                            V&                                   unifiedMinVec,
+                                            V&                                   unifiedMaxVec) const;
+
+  //! Calculates the histogram of the sub-sequence.
+  void          subHistogram               (unsigned int                         initialPos,
+                                            const V&                             minVec,
+                                            const V&                             maxVec,
+                                            std::vector<V*>&                     centersForAllBins,
+                                            std::vector<V*>&                     quanttsForAllBins) const;
+
+  //! Calculates the histogram of the unified sequence.
+  void          unifiedHistogram           (unsigned int                         initialPos,
+                                            const V&                             unifiedMinVec,
+                                            const V&                             unifiedMaxVec,
+                                            std::vector<V*>&                     unifiedCentersForAllBins,
+                                            std::vector<V*>&                     unifiedQuanttsForAllBins) const;
+
+  //! Returns the interquartile range of the values in the sub-sequence.
+  void          subInterQuantileRange      (unsigned int                         initialPos,
+                                            V&                                   iqrVec) const;
+
+  //! Returns the interquartile range of the values in the unified sequence.
+  void          unifiedInterQuantileRange  (unsigned int                         initialPos,
+                                            V&                                   unifiedIqrVec) const;
+
+  //! Selects the scales (bandwidth, \c scaleVec) for the kernel density estimation, considering only the sub-sequence.
+  void          subScalesForKde            (unsigned int                         initialPos,
+                                            const V&                             iqrVec,
+                                            unsigned int                         kdeDimension,
+                                            V&                                   scaleVec) const;
+
+  //! Selects the scales (bandwidth) for the kernel density estimation, considering the unified sequence.
+  void          unifiedScalesForKde        (unsigned int                         initialPos,
+                                            const V&                             unifiedIqrVec,
+                                            unsigned int                         kdeDimension,
+                                            V&                                   unifiedScaleVec) const;
+
+  //! Gaussian kernel for the KDE estimate of the sub-sequence.
+  void          subGaussian1dKde           (unsigned int                         initialPos,
+                                            const V&                             scaleVec,
+                                            const std::vector<V*>&               evalParamVecs,
+                                            std::vector<V*>&                     densityVecs,
+                                            bool                                 binned = false) const;
+
+  //! Gaussian kernel for the KDE estimate of the unified sequence.
+  void          unifiedGaussian1dKde       (unsigned int                         initialPos,
+                                            const V&                             unifiedScaleVec,
+                                            const std::vector<V*>&               unifiedEvalParamVecs,
+                                            std::vector<V*>&                     unifiedDensityVecs,
+                                            bool                                 binned = false) const;
+
+  //! Writes the sub-sequence to a file.
+  /*! Same file formats as SequenceOfVectors<V,M>::subWriteContents(). */
+  void          subWriteContents           (unsigned int                         initialPos,
+                                            unsigned int                         numPos,
+                                            const std::string&                   fileName,
+                                            const std::string&                   fileType,
+                                            const std::set<unsigned int>&        allowedSubEnvIds) const;
+
+  //! Writes the sub-sequence to a file.
+  /*! Uses additional variable of the type FilePtrSetStruct& to operate on files. */
+  void          subWriteContents           (unsigned int                         initialPos,
+                                            unsigned int                         numPos,
+                                            FilePtrSetStruct&                    filePtrSet,
+                                            const std::string&                   fileType) const;
+
+  //! Writes the sub-sequence to a file.
+  /*! Uses object of the type std::ofstream. */
+  void          subWriteContents           (unsigned int                         initialPos,
+                                            unsigned int                         numPos,
+                                            std::ofstream&                       ofs,
+                                            const std::string&                   fileType) const;
+
+  //! Writes the unified sequence in Matlab/Octave format or, if enabled, in HDF5 format.
+  void          unifiedWriteContents       (const std::string&                   fileName,
+                                            const std::string&                   fileType) const;
+
+  //! Reads the unified sequence from a file.
+  /*! Same file formats as SequenceOfVectors<V,M>::unifiedReadContents(). */
+  void          unifiedReadContents        (const std::string&                   fileName,
+                                            const std::string&                   fileType,
+                                            const unsigned int                   subSequenceSize);
+
+  //! TODO: It shall select positions in the sequence of vectors.
+  void          select                     (const std::vector<unsigned int>&     idsOfUniquePositions);
+
+  //! Filters positions in the sequence of vectors.
+  /*! Filtered positions will starting at \c initialPos, and with spacing given by \c spacing. */
+  void          filter                     (unsigned int                         initialPos,
+                                            unsigned int                         spacing);
+
+  //! Estimates convergence rate using Brooks & Gelman method.
+  double        estimateConvBrooksGelman   (unsigned int                         initialPos,
+                                            unsigned int                         numPos) const;
+
+  //! Extracts a sequence of scalars.
+  /*! The sequence of scalars has size \c numPos, and it will be extracted starting at position
+   * (\c initialPos, \c paramId ) of \c this sequences of vectors, given spacing \c spacing.*/
+  void          extractScalarSeq           (unsigned int                         initialPos,
+                                            unsigned int                         spacing,
+                                            unsigned int                         numPos,
+                                            unsigned int                         paramId,
+                                            ScalarSequence<double>&              scalarSeq) const;
+  //@}
+
+private:
+  //! Copies vector sequence \c src to \c this.
+  void          copy                       (const ContiguousSequenceOfVectors<V,M>& src);
+
+  //! Extracts the raw data.
+  /*! This method saves in \c rawData the values of parameter \c paramId, starting at
+   * position \c initialPos, with a spacing of \c spacing until \c numPos positions have
+   * been extracted. */
+  void          extractRawData             (unsigned int                         initialPos,
+                                            unsigned int                         spacing,
+                                            unsigned int                         numPos,
+                                            unsigned int                         paramId,
+                                            std::vector<double>&                 rawData) const;
+
+  //! Checks that [initialPos, initialPos+numPos) is a non-empty range of positions.
+  bool          validRange                 (unsigned int                         initialPos,
+                                            unsigned int                         numPos) const;
+
+  using BaseVectorSequence<V,M>::m_env;
+  using BaseVectorSequence<V,M>::m_vectorSpace;
+  using BaseVectorSequence<V,M>::m_name;
+  using BaseVectorSequence<V,M>::m_fftObj;
+
+  //! Number of positions in the sub-sequence.
+  unsigned int        m_subSequenceSize;
+
+  //! Number of parameters, i.e. local size of each vector.
+  unsigned int        m_numParams;
+
+  //! Values of the sequence; value of parameter \c i at position \c j is m_data[i*m_subSequenceSize+j].
+  std::vector<double> m_data;
+};
+
+}  // End namespace QUESO
+
+#endif // UQ_CONTIGUOUS_SEQUENCE_OF_VECTORS_H
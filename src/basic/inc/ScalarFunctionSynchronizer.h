@@ -25,9 +25,15 @@
 #ifndef UQ_SCALAR_FUNCTION_SYNCHRONIZER_H
 #define UQ_SCALAR_FUNCTION_SYNCHRONIZER_H
 
+#include <vector>
 #include <queso/Environment.h>
 #include <queso/BayesianJointPdf.h>
 
+#define UQ_SCALAR_SYNC_NUM_FLAGS 5
+
+// Value of the first flag announcing a batch of positions (see callFunctions())
+#define UQ_SCALAR_SYNC_BATCH_FLAG 2.
+
 namespace QUESO {
 
 class GslVector;
@@ -41,7 +47,15 @@ class GslMatrix;
  *
  * This class creates a synchronization point among processes which call scalar functions.
  * This means that all processes must reach a point in their code before they can all begin
- * executing again. */
+ * executing again.
+ *
+ * Each call costs a single broadcast over the subcommunicator: the NULL flags of the
+ * arguments and the contents of the position and direction vectors are packed into one
+ * buffer of doubles, allocated once. The vectors handed to the function on ranks other
+ * than 0 are also allocated on the first call and reused afterwards.
+ *
+ * callFunctions() evaluates several positions at once: they are dealt out among the
+ * processes of the subenvironment, each of which calls the function on its own. */
 
 template <class V = GslVector, class M = GslMatrix>
 class ScalarFunctionSynchronizer
@@ -75,12 +89,41 @@ public:
                             V* hessianEffect,
                             double* extraOutput1,
                             double* extraOutput2) const;
+
+  //! Calls the scalar function at each of the positions \c vecValues.
+  /*! On subRank 0, the positions are dealt out among the processes of the subenvironment,
+   * which must be waiting inside callFunction(NULL,...), and every process evaluates its
+   * share on its own: the function must then not communicate over the subcommunicator.
+   * The results (and, for a BayesianJointPdf, the log prior and log likelihood in
+   * \c extraOutputs1 and \c extraOutputs2, which may be NULL) are returned on subRank 0.
+   * If callFunction() does not use worker processes, the positions are evaluated in turn. */
+  void callFunctions(const std::vector<const V*>& vecValues,
+                     std::vector<double>&         results,
+                     std::vector<double>*         extraOutputs1,
+                     std::vector<double>*         extraOutputs2) const;
   //@}
 private:
+  //! Evaluates, on every process, its share of the \c numPositions positions in m_batchBuffer.
+  void evaluateBatch(unsigned int numPositions) const;
+
   const BaseEnvironment&         m_env;
   const BaseScalarFunction<V,M>& m_scalarFunction;
   const BayesianJointPdf<V,M>*   m_bayesianJointPdfPtr;
   const V&                              m_auxVec;
+
+  //! Packed flags, position and direction, sent with one broadcast per call.
+  mutable std::vector<double>  m_buffer;
+
+  //! Positions of a batch, then its results (three doubles per position).
+  mutable std::vector<double>  m_batchBuffer;
+  mutable std::vector<double>  m_batchResults;
+
+  //! Arguments of the function on subRank != 0, reused across calls; outputs are zeroed before each one.
+  mutable V*                   m_workerValues;
+  mutable V*                   m_workerDirection;
+  mutable V*                   m_workerGrad;
+  mutable M*                   m_workerHessian;
+  mutable V*                   m_workerEffect;
 };
 
 }  // End namespace QUESO
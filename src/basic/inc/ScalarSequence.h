@@ -30,10 +30,16 @@
 #include <queso/Environment.h>
 #include <queso/Miscellaneous.h>
 #include <queso/Defines.h>
+#include <queso/BinaryChainWriter.h>
 #include <vector>
 #include <complex>
 #include <sys/time.h>
 
+// Grid limits and kernel truncation (in bandwidths) for the binned KDE
+#define UQ_KDE_BINNED_MIN_NUM_BINS 512
+#define UQ_KDE_BINNED_MAX_NUM_BINS 262144
+#define UQ_KDE_BINNED_NUM_SCALES   5.
+
 #define SCALAR_SEQUENCE_INIT_MPI_MSG 1
 #define SCALAR_SEQUENCE_SIZE_MPI_MSG 1
 #define SCALAR_SEQUENCE_DATA_MPI_MSG 1
@@ -389,6 +395,27 @@ public:
                                              const std::vector<T>&           unifiedEvaluationPositions,
                                              std::vector<double>&            unifiedDensityValues) const;
 
+  //! Binned Gaussian kernel for the KDE estimate of the sub-sequence.
+  /*! Same estimate as subGaussian1dKde(), but the sample is first linearly binned onto a
+   * uniform grid covering the data and \c evaluationPositions, the bin counts are convolved
+   * with the Gaussian kernel through an FFT, and the result is linearly interpolated at
+   * \c evaluationPositions. The cost is O(N + G log G) for N samples and G grid points,
+   * instead of O(N x numEvals); the grid spacing is at most a quarter of \c scaleValue
+   * unless that would exceed the maximum grid size. */
+  void         subGaussian1dKdeBinned       (unsigned int                    initialPos,
+                                             double                          scaleValue,
+                                             const std::vector<T>&           evaluationPositions,
+                                             std::vector<double>&            densityValues) const;
+
+  //! Binned Gaussian kernel for the KDE estimate of the unified sequence.
+  /*! Only the bin counts (and the sample size) are summed over the 'inter0' communicator;
+   * each node then performs the convolution on the shared grid itself. */
+  void         unifiedGaussian1dKdeBinned   (bool                            useOnlyInter0Comm,
+                                             unsigned int                    initialPos,
+                                             double                          unifiedScaleValue,
+                                             const std::vector<T>&           unifiedEvaluationPositions,
+                                             std::vector<double>&            unifiedDensityValues) const;
+
   //! Filters positions in the sequence of vectors.
   /*! Filtered positions will start at \c initialPos, and with spacing given by \c spacing. */
   void         filter                       (unsigned int                    initialPos,
@@ -437,6 +464,15 @@ public:
   void         unifiedReadContents          (const std::string&              fileName,
 					     const std::string&              fileType,
 					     const unsigned int              subSequenceSize);
+
+  //! Appends the positions \c initialPos to \c initialPos+numPos-1 of the sub-sequence to \c writer, one record per position.
+  void         subAppendBinaryContents      (unsigned int                    initialPos,
+					     unsigned int                    numPos,
+					     BinaryChainWriter&              writer) const;
+
+  //! Reads the first \c subSequenceSize records of a file written by BinaryChainWriter into the sub-sequence.
+  void         subReadBinaryContents        (const std::string&              fileName,
+					     unsigned int                    subSequenceSize);
 #ifdef QUESO_COMPUTES_EXTRA_POST_PROCESSING_STATISTICS
   T            bmm                          (unsigned int                    initialPos,
                                              unsigned int                    batchLength) const;
@@ -495,6 +531,22 @@ private:
   //! Helper function to write txt info for matlab files
   void writeTxtHeader(std::ofstream & ofs, double sequenceSize) const;
 
+  //! Adds the linear binning weights of the sub-sequence, starting at \c initialPos, to \c binCounts.
+  /*! Grid point \c l is located at <tt>gridMin + l * gridDelta</tt>. */
+  void         linearBinForKde              (unsigned int                    initialPos,
+                                             double                          gridMin,
+                                             double                          gridDelta,
+                                             std::vector<double>&            binCounts) const;
+
+  //! Convolves \c binCounts with the Gaussian kernel and interpolates the density at \c evaluationPositions.
+  void         convolveBinsForKde           (double                          scaleValue,
+                                             double                          gridMin,
+                                             double                          gridDelta,
+                                             const std::vector<double>&      binCounts,
+                                             double                          dataSize,
+                                             const std::vector<T>&           evaluationPositions,
+                                             std::vector<double>&            densityValues) const;
+
   //! Extracts a sequence of scalars.
   /*! The sequence of scalars has size \c numPos, and it will be extracted starting at position
    * (\c initialPos) of \c this sequence of scalars, given spacing \c spacing.*/
@@ -274,12 +274,14 @@ public:
   void         subGaussian1dKde           (unsigned int                         initialPos,
                                            const V&                             scaleVec,
                                            const std::vector<V*>&               evalParamVecs,
-                                           std::vector<V*>&                     densityVecs) const;
+                                           std::vector<V*>&                     densityVecs,
+                                           bool                                 binned = false) const;
   //! Gaussian kernel for the KDE estimate of the unified sequence.
   void         unifiedGaussian1dKde       (unsigned int                         initialPos,
                                            const V&                             unifiedScaleVec,
                                            const std::vector<V*>&               unifiedEvalParamVecs,
-                                           std::vector<V*>&                     unifiedDensityVecs) const;
+                                           std::vector<V*>&                     unifiedDensityVecs,
+                                           bool                                 binned = false) const;
   //! Writes the sub-sequence to a file.
   /*! Given the allowed sub environments (\c allowedSubEnvIds) that are allowed to write to file,
    * together with the file name and type (\c fileName, \c fileType), it writes the entire sub-
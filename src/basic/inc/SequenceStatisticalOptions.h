@@ -74,6 +74,7 @@
 #define UQ_SEQUENCE_AUTO_CORR_WRITE_ODV              0
 #define UQ_SEQUENCE_KDE_COMPUTE_ODV                  0
 #define UQ_SEQUENCE_KDE_NUM_EVAL_POSITIONS_ODV       100
+#define UQ_SEQUENCE_KDE_BINNED_ODV                   0
 #define UQ_SEQUENCE_COV_MATRIX_COMPUTE_ODV           0
 #define UQ_SEQUENCE_CORR_MATRIX_COMPUTE_ODV          0
 
@@ -153,6 +154,9 @@ public:
   //! Number of positions to evaluate kde.
   unsigned int              m_kdeNumEvalPositions;
 
+  //! Whether or not to compute the kde on a linearly binned grid via FFT convolution.
+  bool                      m_kdeBinned;
+
   //! Whether or not compute covariance matrix.
   bool                      m_covMatrixCompute;
 
@@ -216,6 +220,7 @@ private:
   std::string                   m_option_autoCorr_write;
   std::string                   m_option_kde_compute;
   std::string                   m_option_kde_numEvalPositions;
+  std::string                   m_option_kde_binned;
   std::string                   m_option_covMatrix_compute;
   std::string                   m_option_corrMatrix_compute;
 
@@ -320,6 +325,9 @@ public:
   //! Returns number of evaluation positions for KDE. Access to private attribute m_kdeNumEvalPositions
   unsigned int               kdeNumEvalPositions() const;
 
+  //! Whether KDE is computed on a binned grid. Access to private attribute m_kdeBinned
+  bool                       kdeBinned          () const;
+
   //! Finds the covariance matrix. Access to private attribute m_covMatrixCompute
   bool                       covMatrixCompute () const;
 
@@ -403,6 +411,7 @@ private:
   std::string                   m_option_autoCorr_write;
   std::string                   m_option_kde_compute;
   std::string                   m_option_kde_numEvalPositions;
+  std::string                   m_option_kde_binned;
   std::string                   m_option_covMatrix_compute;
   std::string                   m_option_corrMatrix_compute;
 
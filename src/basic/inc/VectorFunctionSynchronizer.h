@@ -25,8 +25,11 @@
 #ifndef UQ_VECTOR_FUNCTION_SYNCHRONIZER_H
 #define UQ_VECTOR_FUNCTION_SYNCHRONIZER_H
 
+#include <vector>
 #include <queso/VectorFunction.h>
 
+#define UQ_VECTOR_SYNC_NUM_FLAGS 6
+
 namespace QUESO {
 
 class GslVector;
@@ -40,7 +43,12 @@ class GslMatrix;
  *
  * This class creates a synchronization point among processes which call vector-valued
  * functions. This means that all processes must reach a point in their code before they
- * can all begin executing again. */
+ * can all begin executing again.
+ *
+ * Each call costs a single broadcast over the subcommunicator: the NULL flags of the
+ * arguments and the contents of the position and direction vectors are packed into one
+ * buffer of doubles, allocated once. Ranks other than 0 reuse their input and image
+ * vectors across calls. */
 
 template <class P_V = GslVector, class P_M = GslMatrix, class Q_V = GslVector, class Q_M = GslMatrix>
 class VectorFunctionSynchronizer
@@ -79,6 +87,14 @@ private:
   const BaseVectorFunction<P_V,P_M,Q_V,Q_M>& m_vectorFunction;
   const P_V&                                        m_auxPVec;
   const Q_V&                                        m_auxQVec;
+
+  //! Packed flags, position and direction, sent with one broadcast per call.
+  mutable std::vector<double>                m_buffer;
+
+  //! Arguments of the function on subRank != 0, reused across calls; outputs are zeroed before each one.
+  mutable P_V*                               m_workerValues;
+  mutable P_V*                               m_workerDirection;
+  mutable Q_V*                               m_workerImageVec;
 };
 
 }  // End namespace QUESO
@@ -30,6 +30,7 @@
 #include <queso/VectorSpace.h>
 #include <queso/BoxSubset.h>
 #include <queso/ScalarSequence.h>
+#include <queso/BinaryChainWriter.h>
 #include <queso/SequenceStatisticalOptions.h>
 #include <queso/ArrayOfOneDGrids.h>
 #include <queso/ArrayOfOneDTables.h>
@@ -253,6 +254,25 @@ public:
 						       unsigned int                             numPos,
 						       unsigned int                             numSum,
 						       V&                                       autoCorrsSumVec) const = 0;
+  //! Calculates, via FFT, autocorrelation results for all parameters in one sweep.
+  /*! Considers \c numPos positions starting at position \c initialPos. For every parameter,
+   * a single forward/inverse FFT pair, sharing one buffer and the FFT tables cached by the
+   * sequence, provides: the autocorrelations at \c lags (stored in \c corrVecs, as in
+   * autoCorrViaFft()); if \c autoCorrsSumVec is not \c NULL, the sum of the first \c numSum
+   * autocorrelations; and, if \c effectiveSampleSizeVec is not \c NULL, the effective sample
+   * size, \c numPos divided by the integrated autocorrelation time given by Geyer's initial
+   * monotone sequence estimator. \c lags may be empty. */
+          void            batchAutoCorrViaFft         (unsigned int                             initialPos,
+						       unsigned int                             numPos,
+						       const std::vector<unsigned int>&         lags,
+						       std::vector<V*>&                         corrVecs,
+						       unsigned int                             numSum,
+						       V*                                       autoCorrsSumVec,
+						       V*                                       effectiveSampleSizeVec) const;
+  //! Estimates the effective sample size of each parameter of the sub-sequence. See batchAutoCorrViaFft().
+          void            subEffectiveSampleSize      (unsigned int                             initialPos,
+						       unsigned int                             numPos,
+						       V&                                       essVec) const;
 
 
   //! Finds the minimum and the maximum values of the sub-sequence, considering \c numPos positions starting at position \c initialPos. See template specialization.
@@ -265,6 +285,35 @@ public:
 						       unsigned int                             numPos,
 						       V&                                       unifiedMinVec,
 						       V&                                       unifiedMaxVec) const = 0;
+
+  //! Finds the mean, variances, extrema and covariance of the sub-sequence in a single pass.
+  /*! Considers \c numPos positions starting at position \c initialPos. The moments of all
+   * parameters are accumulated together with Welford's update, so the chain is read only
+   * once. Any of the output pointers may be \c NULL, in which case that statistic is not
+   * returned; the covariance (sample, i.e. with the 'N-1' denominator) is only accumulated
+   * when \c covMatrix is not \c NULL. */
+          void            subMomentsExtra             (unsigned int                             initialPos,
+						       unsigned int                             numPos,
+						       V*                                       meanVec,
+						       V*                                       sampleVarVec,
+						       V*                                       populVarVec,
+						       V*                                       minVec,
+						       V*                                       maxVec,
+						       M*                                       covMatrix) const;
+  //! Finds the mean, variances, extrema and covariance of the unified sequence in a single pass.
+  /*! Same as subMomentsExtra(), but the partial moments of each sub sequence are combined
+   * with the pairwise formula of Chan, Golub and LeVeque, after exchanging all of them in one
+   * MPI reduction over the 'inter0' communicator. The unified results are only available on
+   * the nodes of the 'inter0' communicator; the other nodes get the statistics of their own
+   * sub sequence. */
+          void            unifiedMomentsExtra         (unsigned int                             initialPos,
+						       unsigned int                             numPos,
+						       V*                                       unifiedMeanVec,
+						       V*                                       unifiedSampleVarVec,
+						       V*                                       unifiedPopulVarVec,
+						       V*                                       unifiedMinVec,
+						       V*                                       unifiedMaxVec,
+						       M*                                       unifiedCovMatrix) const;
   //! Calculates the histogram of the sub-sequence. See template specialization.
   /*! The IQR is a robust estimate of the spread of the data, since changes in the upper and
   * lower 25% of the data do not affect it. If there are outliers in the data, then the IQR
@@ -312,16 +361,19 @@ public:
   /*! Computes a probability density estimate of the sample in \c this sub-sequence, starting
    * at position \c initialPos. \c densityVecs is the vector of density values evaluated at
    * the points in \c evaluationParamVecs. The estimate is based on Gaussian (normal) kernel
-   * function, using a window parameter (\c scaleVec).*/
+   * function, using a window parameter (\c scaleVec). If \c binned is true, each component
+   * uses the FFT-based ScalarSequence::subGaussian1dKdeBinned() instead of direct summation.*/
   virtual  void           subGaussian1dKde            (unsigned int                             initialPos,
 						       const V&                                 scaleVec,
 						       const std::vector<V*>&                   evaluationParamVecs,
-						       std::vector<V*>&                         densityVecs) const = 0;
+						       std::vector<V*>&                         densityVecs,
+						       bool                                     binned = false) const = 0;
   //! Gaussian kernel for the KDE estimate of the unified sequence. See template specialization.
   virtual  void           unifiedGaussian1dKde        (unsigned int                             initialPos,
 						       const V&                                 unifiedScaleVec,
 						       const std::vector<V*>&                   unifiedEvaluationParamVecs,
-						       std::vector<V*>&                         unifiedDensityVecs) const = 0;
+						       std::vector<V*>&                         unifiedDensityVecs,
+						       bool                                     binned = false) const = 0;
   //! Writes info of the sub-sequence to a file. See template specialization.
   virtual  void           subWriteContents            (unsigned int                             initialPos,
 						       unsigned int                             numPos,
@@ -340,6 +392,13 @@ public:
   virtual  void           unifiedReadContents         (const std::string&                       fileName,
 						       const std::string&                       fileType,
 						       const unsigned int                       subSequenceSize) = 0;
+  //! Appends the positions \c initialPos to \c initialPos+numPos-1 of the sub-sequence to \c writer, one record per position.
+  void                    subAppendBinaryContents     (unsigned int                             initialPos,
+						       unsigned int                             numPos,
+						       BinaryChainWriter&                       writer) const;
+  //! Reads the first \c subSequenceSize records of a file written by BinaryChainWriter into the sub-sequence.
+  void                    subReadBinaryContents       (const std::string&                       fileName,
+						       unsigned int                             subSequenceSize);
   //! Select positions in the sequence of vectors. See template specialization.
   virtual  void           select                      (const std::vector<unsigned int>&         idsOfUniquePositions) = 0;
 
@@ -428,6 +487,36 @@ protected:
                                                        unsigned int                             paramId,
                                                        std::vector<double>&                     rawData) const = 0;
 
+  //! Accumulates the packed partial moments (count, mean, min, max, co-moments) of \c numPos positions.
+  void           subMomentsPartials          (unsigned int                             initialPos,
+                                              unsigned int                             numPos,
+                                              bool                                     computeCov,
+                                              std::vector<double>&                     partials) const;
+
+  //! Replaces the packed partial moments of the sub sequence by those of the unified sequence, on the nodes of the 'inter0' communicator.
+  void           unifyMomentsPartials        (bool                                     computeCov,
+                                              std::vector<double>&                     partials) const;
+
+  //! Sums of the squared deviations from \c centerVec of \c numPos positions starting at \c initialPos.
+  /*! The sums come from the packed partial moments, so the sequence is read once for all
+   * parameters; when \c unified is true they cover the unified sequence, at the cost of a
+   * single MPI reduction. Returns the number of positions summed over. */
+  double         squaredDeviationsExtra      (bool                                     unified,
+                                              unsigned int                             initialPos,
+                                              unsigned int                             numPos,
+                                              const V&                                 centerVec,
+                                              V&                                       sqDevVec) const;
+
+  //! Fills the requested outputs of subMomentsExtra() / unifiedMomentsExtra() from packed partial moments.
+  void           unpackMoments               (const std::vector<double>&               partials,
+                                              bool                                     computeCov,
+                                              V*                                       meanVec,
+                                              V*                                       sampleVarVec,
+                                              V*                                       populVarVec,
+                                              V*                                       minVec,
+                                              V*                                       maxVec,
+                                              M*                                       covMatrix) const;
+
   const BaseEnvironment&  m_env;
   const VectorSpace<V,M>& m_vectorSpace;
   std::string                    m_name;
@@ -32,13 +32,9 @@
 #include <ANN/ANNperf.h>				// performance evaluation
 
 //----------------------------------------------------------------------
-//	Global variables
-//		These are active for the life of each call to
-//		annRangeSearch().  They are set to save the number of
-//		variables that need to be passed among the various search
-//		procedures.
+//	The state of each call to annkFRSearch() is kept in an
+//	ANNkdSearchCtx (see kd_tree.h), which is passed among the various
+//	search procedures, so the fixed-radius search is reentrant.
 //----------------------------------------------------------------------
 
-extern ANNpoint			ANNkdFRQ;			// query point (static copy)
-
 #endif
@@ -32,17 +32,9 @@
 #include <ANN/ANNperf.h>				// performance evaluation
 
 //----------------------------------------------------------------------
-//	More global variables
-//		These are active for the life of each call to annkSearch(). They
-//		are set to save the number of variables that need to be passed
-//		among the various search procedures.
+//	The state of each call to annkSearch() is kept in an ANNkdSearchCtx
+//	(see kd_tree.h), which is passed among the various search
+//	procedures, so the standard search is reentrant.
 //----------------------------------------------------------------------
 
-extern int				ANNkdDim;		// dimension of space (static copy)
-extern ANNpoint			ANNkdQ;			// query point (static copy)
-extern double			ANNkdMaxErr;	// max tolerable squared error
-extern ANNpointArray	ANNkdPts;		// the points (static copy)
-extern ANNmin_k			*ANNkdPointMK;	// set of k closest points
-extern int				ANNptsVisited;	// number of points visited
-
 #endif
@@ -31,6 +31,27 @@
 
 using namespace std;					// make std:: available
 
+class ANNmin_k;							// k-element priority queue
+
+//----------------------------------------------------------------------
+//	Search context
+//		The state shared by the recursive calls of a single standard or
+//		fixed-radius search.  It lives on the caller's stack (instead of
+//		in file-scope globals), so that several threads may search the
+//		same tree concurrently.
+//----------------------------------------------------------------------
+
+struct ANNkdSearchCtx {
+	int					dim;			// dimension of space
+	ANNpoint			q;				// query point
+	double				maxErr;			// max tolerable squared error
+	ANNdist				sqRad;			// squared radius (fixed-radius only)
+	ANNpointArray		pts;			// the points
+	ANNmin_k			*pointMK;		// set of k closest points
+	int					ptsVisited;		// number of points visited
+	int					ptsInRange;		// points in range (fixed-radius only)
+};
+
 //----------------------------------------------------------------------
 //	Generic kd-tree node
 //
@@ -47,9 +68,9 @@ class ANNkd_node{						// generic kd-tree node (empty shell)
 public:
 	virtual ~ANNkd_node() {}					// virtual distroyer
 
-	virtual void ann_search(ANNdist) = 0;		// tree search
-	virtual void ann_pri_search(ANNdist) = 0;	// priority search
-	virtual void ann_FR_search(ANNdist) = 0;	// fixed-radius search
+	virtual void ann_search(ANNdist, ANNkdSearchCtx&) = 0;		// tree search
+	virtual void ann_pri_search(ANNdist) = 0;					// priority search
+	virtual void ann_FR_search(ANNdist, ANNkdSearchCtx&) = 0;	// fixed-radius search
 
 	virtual void getStats(						// get tree statistics
 				int dim,						// dimension of space
@@ -110,9 +131,9 @@ public:
 	virtual void print(int level, ostream &out);// print node
 	virtual void dump(ostream &out);			// dump node
 
-	virtual void ann_search(ANNdist);			// standard search
-	virtual void ann_pri_search(ANNdist);		// priority search
-	virtual void ann_FR_search(ANNdist);		// fixed-radius search
+	virtual void ann_search(ANNdist, ANNkdSearchCtx&);		// standard search
+	virtual void ann_pri_search(ANNdist);					// priority search
+	virtual void ann_FR_search(ANNdist, ANNkdSearchCtx&);	// fixed-radius search
 };
 
 //----------------------------------------------------------------------
@@ -176,9 +197,9 @@ public:
 	virtual void print(int level, ostream &out);// print node
 	virtual void dump(ostream &out);			// dump node
 
-	virtual void ann_search(ANNdist);			// standard search
-	virtual void ann_pri_search(ANNdist);		// priority search
-	virtual void ann_FR_search(ANNdist);		// fixed-radius search
+	virtual void ann_search(ANNdist, ANNkdSearchCtx&);		// standard search
+	virtual void ann_pri_search(ANNdist);					// priority search
+	virtual void ann_FR_search(ANNdist, ANNkdSearchCtx&);	// fixed-radius search
 };
 
 //----------------------------------------------------------------------
@@ -166,6 +166,7 @@
 #include<queso/VectorFunction.h>
 #include<queso/InstantiateIntersection.h>
 #include<queso/SequenceOfVectors.h>
+#include<queso/ContiguousSequenceOfVectors.h>
 #include<queso/BoxSubset.h>
 #include<queso/GenericScalarFunction.h>
 #include<queso/SequenceStatisticalOptions.h>
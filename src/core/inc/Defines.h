@@ -102,6 +102,7 @@ const int UQ_MATRIX_SVD_FAILED_RC          = -11;
 #define UQ_FILE_EXTENSION_FOR_MATLAB_FORMAT "m"
 #define UQ_FILE_EXTENSION_FOR_TXT_FORMAT    "txt"
 #define UQ_FILE_EXTENSION_FOR_HDF_FORMAT    "h5"
+#define UQ_FILE_EXTENSION_FOR_BINARY_FORMAT "bin"
 
 
 /*! \file Defines.h
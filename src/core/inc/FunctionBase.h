@@ -26,6 +26,7 @@
 #define QUESO_FUNCTION_BASE_H
 
 #include <string>
+#include <vector>
 #include <boost/shared_ptr.hpp>
 
 namespace QUESO {
@@ -80,6 +81,13 @@ public:
 
   //! Save the current function to an Exodus file called \c filename.  \c time is the time to attach to the function and is usually the iteration number
   virtual void save_function(const std::string & filename, double time) const = 0;
+
+  //! Copy the (global) coefficients of \c this into \c values
+  /*!
+   * Must be called by all processes sharing \c this.  The default
+   * implementation throws NotImplemented.
+   */
+  virtual void get_values(std::vector<double> & values) const;
 };
 
 }  // End namespace QUESO
@@ -175,6 +175,23 @@ public:
   /*! In case \this fails to be symmetric and positive definite, an error will be returned. */
   int               chol                      ();
 
+  //! Updates the lower triangular Cholesky factor held in \c this so that it factors \f$ L L^T + x x^T \f$.
+  /*! The lower triangle of \c this must hold the factor \f$ L \f$ (e.g. as left by chol()).
+   * The update costs O(n^2), as opposed to the O(n^3) of a new factorisation.  The
+   * strictly upper triangle of \c this is set to zero. */
+  int               cholRankOneUpdate         (const GslVector& x);
+
+  //! Downdates the lower triangular Cholesky factor held in \c this so that it factors \f$ L L^T - x x^T \f$.
+  /*! If the downdated matrix is not positive definite, \c this is left untouched and
+   * UQ_MATRIX_IS_NOT_POS_DEFINITE_RC is returned. */
+  int               cholRankOneDowndate       (const GslVector& x);
+
+  //! Solves \c this x = b for a symmetric positive definite \c this via a Cholesky factorisation, and sets \c lnDet to \f$ \ln \det \f$ of \c this from the same factor.
+  /*! \c this is left untouched and the determinant itself is never formed. If \c this is not
+   * positive definite, UQ_MATRIX_IS_NOT_POS_DEFINITE_RC is returned silently so that callers
+   * may fall back to an LU based solve. */
+  int               cholSolve                 (const GslVector& b, GslVector& x, double& lnDet) const;
+
 //! Checks for the dimension of \c this matrix, \c matU, \c VecS and \c matVt, and calls the protected routine \c internalSvd to compute the singular values of \c this.
   int               svd                       (GslMatrix& matU, GslVector& vecS, GslMatrix& matVt) const;
 
@@ -206,8 +223,47 @@ public:
 
   //! This function multiplies \c this matrix by matrix \c X and fills
   //the preallocated zeroed matrix \c Y.
+  /*! The product is accumulated into \c Y (Y += this*X), so \c Y must be zero on entry
+   *  unless accumulating is intended. Unlike transposeMultiply(const GslMatrix&, GslMatrix&),
+   *  which overwrites \c Y. */
   void       multiply                  (const GslMatrix& X, GslMatrix& Y) const;
 
+  //! This function multiplies the transpose of \c this matrix by vector \c x and returns the resulting vector.
+  GslVector  transposeMultiply         (const GslVector& x) const;
+
+  //! This function multiplies the transpose of \c this matrix by vector \c x and fills
+  //the preallocated vector \c y.
+  void       transposeMultiply         (const GslVector& x, GslVector& y) const;
+
+  //! This function multiplies the transpose of \c this matrix by matrix \c X and
+  //overwrites the preallocated matrix \c Y with the result.
+  /*! The previous contents of \c Y are ignored (Y = this^T*X). Unlike
+   *  multiply(const GslMatrix&, GslMatrix&), which accumulates into \c Y. */
+  void       transposeMultiply         (const GslMatrix& X, GslMatrix& Y) const;
+
+  //! This function multiplies \c this symmetric matrix by vector \c x and fills the preallocated vector \c y.
+  /*! Only the lower triangle of \c this matrix is referenced.*/
+  void       symmetricMultiply         (const GslVector& x, GslVector& y) const;
+
+  //! Symmetric rank-k update: \c this = alpha * A * A^T + beta * \c this, or alpha * A^T * A + beta * \c this if \c transposeA is true.
+  /*! \c this must be square. Both triangles of \c this are filled on return.*/
+  void       symmetricRankKUpdate      (const GslMatrix& A, bool transposeA, double alpha, double beta);
+
+  //! Overwrites vector \c x with L * x, where L is the lower triangle (diagonal included) of \c this square matrix.
+  void       lowerTriangularMultiply   (GslVector& x) const;
+
+  //! Overwrites matrix \c X with L * X, where L is the lower triangle (diagonal included) of \c this square matrix.
+  void       lowerTriangularMultiply   (GslMatrix& X) const;
+
+  //! Overwrites matrix \c X with L^{-1} * X, where L is the lower triangle (diagonal included) of \c this square matrix.
+  void       lowerTriangularSolve      (GslMatrix& X) const;
+
+  //! Overwrites vector \c x with L^{-T} * x, where L is the lower triangle (diagonal included) of \c this square matrix.
+  void       lowerTriangularTransposeSolve(GslVector& x) const;
+
+  //! Overwrites matrix \c X with L^{-T} * X, where L is the lower triangle (diagonal included) of \c this square matrix.
+  void       lowerTriangularTransposeSolve(GslMatrix& X) const;
+
   //! This function calculates the inverse of \c this matrix and multiplies it with vector \c b.
   /*! It calls void GslMatrix::invertMultiply(const GslVector& b, GslVector& x) internally.*/
   GslVector  invertMultiply            (const GslVector& b) const;
@@ -405,6 +461,9 @@ private:
   //! This function factorizes the M-by-N matrix A into the singular value decomposition A = U S V^T for M >= N. On output the matrix A is replaced by U.
   int               internalSvd               () const;
 
+  //! Applies a rank-one update (\c sign = 1) or downdate (\c sign = -1) to the lower Cholesky factor held in \c this.
+  int               cholRankOneModify         (const GslVector& x, double sign);
+
   //! GSL matrix, also referred to as \c this matrix.
           gsl_matrix*       m_mat;
 
@@ -151,6 +151,27 @@ public:
   //! Sets the tolerance to use for line minimisation
   virtual void setLineTolerance(double lineTolerance);
 
+  //! Returns minus the log of the objective function at \c x
+  /*!
+   * Used by the GSL callbacks.  The objective function is not asked for its
+   * gradient here.  The last point, value and gradient are cached, so asking
+   * for the value and the gradient at the same point, in either order,
+   * evaluates the objective function there only once (after the first
+   * gradient request, if the objective function does not fill gradients).
+   * Returns GSL_NAN outside of the domain.
+   */
+  double minusLnValue(const GslVector & x);
+
+  //! Fills \c gradient with the gradient of minus the log of the objective function at \c x
+  /*!
+   * If the objective function does not fill its gradient, a forward (or
+   * central, see BaseOptimizer::setFiniteDifferenceCentral()) finite
+   * difference is used instead.  When
+   * BaseOptimizer::setFiniteDifferenceDistribute() is set, the perturbed
+   * evaluations are spread over the subenvironments.
+   */
+  void minusLnValueGradient(const GslVector & x, GslVector & gradient);
+
 private:
   const BaseScalarFunction<GslVector, GslMatrix> & m_objectiveFunction;
 
@@ -168,6 +189,28 @@ private:
   //! Line minimization tolerance in gradient-based algorithms
   double m_line_tol;
 
+  //! Last point at which the objective function was evaluated
+  GslVector m_cachedPoint;
+
+  //! Minus the log of the objective function at m_cachedPoint
+  double m_cachedValue;
+
+  //! Gradient of minus the log of the objective function at m_cachedPoint
+  GslVector m_cachedGradient;
+
+  bool m_cachedValueValid;
+  bool m_cachedGradientValid;
+
+  //! Whether the objective function has been asked for its gradient yet
+  bool m_gradientProbed;
+
+  //! Whether the objective function filled its gradient when asked
+  /*!
+   * Once known to be false, gradients are finite differences straight away,
+   * reusing a cached value at the same point.
+   */
+  bool m_objectiveProvidesGradient;
+
   //! Helper function
   bool solver_needs_gradient(SolverType solver);
 
@@ -175,6 +218,12 @@ private:
 
   void minimize_no_gradient( unsigned int dim, OptimizerMonitor* monitor );
 
+  //! Fills the cache at \c x with the value and, if asked for, the gradient
+  void evaluate( const GslVector & x, bool needGradient );
+
+  //! Finite difference gradient at m_cachedPoint, using m_cachedValue
+  void finite_difference_gradient();
+
 };
 
 }  // End namespace QUESO
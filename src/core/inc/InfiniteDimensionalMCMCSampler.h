@@ -29,6 +29,8 @@
 #ifndef QUESO_INFINITE_SAMPLER_H
 #define QUESO_INFINITE_SAMPLER_H
 
+#include <vector>
+
 // Boost includes
 #include <boost/scoped_ptr.hpp>
 #include <boost/shared_ptr.hpp>
@@ -144,6 +146,27 @@ private:
   hid_t _L2_norm_mean_dset;
   hid_t _L2_norm_var_dset;
 
+  // HDF5 datasets of the fields; only created if they are saved in the file
+  hid_t _sample_dset;
+  hid_t _mean_dset;
+  hid_t _var_dset;
+
+  // Number of rows written to each of the field datasets
+  hsize_t _num_field_rows;
+
+  // Scalar diagnostics not written yet, one block of m_buffer_size entries
+  // per scalar dataset, in the order the datasets are created
+  std::vector<double> _scalar_buffer;
+
+  // Number of saved states in _scalar_buffer
+  unsigned int _num_buffered;
+
+  // Number of saved states already written to the scalar datasets
+  hsize_t _num_flushed;
+
+  // Scratch space for the coefficients of a field
+  std::vector<double> _field_values;
+
   /*!
    * Make a proposal from the prior using a standard random walk
    */
@@ -158,11 +181,27 @@ private:
   // Write the current state of the chain to disk
   void _write_state();
 
+  // Creates a dataset called \c name in \c _outfile file, whose rows have
+  // \c num_cols entries (a 1D dataset if \c num_cols is 0) and can be
+  // appended to in chunks of \c chunk_rows rows, and returns it
+  hid_t _create_appendable_dataset(const std::string & name,
+      hsize_t num_cols, hsize_t chunk_rows);
+
   // Creates a scalar dataset called \c name in \c _outfile file and returns it
   hid_t _create_scalar_dataset(const std::string & name);
 
-  // Appends to a scalar dataset in the hdf5 file
-  void _append_scalar_dataset(hid_t dset, double data);
+  // Appends the \c n values in \c data to a scalar dataset in the hdf5 file,
+  // which currently holds \c size values
+  void _append_scalar_dataset(hid_t dset, hsize_t size, const double * data,
+      unsigned int n);
+
+  // Writes the buffered scalar diagnostics to the hdf5 file
+  void _flush_scalar_datasets();
+
+  // Appends \c field as row \c _num_field_rows of the field dataset \c dset,
+  // first creating \c dset with name \c name if there are no rows yet
+  void _append_field_dataset(hid_t & dset, const std::string & name,
+      const FunctionBase & field);
 };
 
 }  // End namespace QUESO
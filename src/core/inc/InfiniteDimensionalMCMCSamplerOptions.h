@@ -74,6 +74,24 @@ public:
   //! The proposal step size
   double m_rwmh_step;
 
+  //! The number of saved states whose scalar diagnostics are kept in memory
+  /*!
+   * The scalar diagnostics (acceptance probabilities, likelihood and norms)
+   * are written to the HDF5 file in blocks of this many saved states, which
+   * is also the chunk size of their datasets.  Whatever is left in memory is
+   * written when the sampler is destroyed.
+   */
+  unsigned int m_buffer_size;
+
+  //! Whether to save the sample, mean and variance fields in the HDF5 file
+  /*!
+   * If true, each saved field is appended as a row of the 'sample', 'mean'
+   * and 'var' datasets of the HDF5 output file, instead of being written as
+   * one Exodus file per saved state.  Requires a FunctionBase implementing
+   * get_values().
+   */
+  bool m_save_fields_hdf5;
+
   //! Returns the QUESO environment
   const BaseEnvironment& env() const;
 
@@ -88,6 +106,8 @@ private:
   std::string m_option_num_iters;
   std::string m_option_save_freq;
   std::string m_option_rwmh_step;
+  std::string m_option_buffer_size;
+  std::string m_option_save_fields_hdf5;
 
   void checkOptions();
 
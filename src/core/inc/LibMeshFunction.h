@@ -76,6 +76,9 @@ public:
   //! Save the current function to an Exodus file called \c filename.  \c time is the time to attach to the function and is usually the iteration number
   virtual void save_function(const std::string & filename, double time) const;
 
+  //! Copy the (global) coefficients of \c this into \c values
+  virtual void get_values(std::vector<double> & values) const;
+
   //! Execute \c this += \c scale * \c rhs
   virtual void add(double scale, const FunctionBase & rhs);
 
@@ -350,6 +350,13 @@ public:
                int * displs, int root, const char * whereMsg,
                const char * whatMsg) const;
 
+  //! Nonblocking test for a message from another process.
+  /*! Returns true if a message with the given source and tag can be received
+   * with Recv().
+   * \param source rank of source, or RawValue_MPI_ANY_SOURCE
+   * \param tag message tag */
+  bool               Iprobe   (int source, int tag, const char* whereMsg, const char* whatMsg) const;
+
   //! Blocking receive of data from this process to another process.
   /*!\param buf (output) initial address of receive buffer
    * \param status (output) status object
@@ -79,6 +79,18 @@ public:
    */
   double getFiniteDifferenceStepSize() const;
 
+  //! Returns whether finite difference gradients use central differences
+  /*!
+   * Default value is false (forward differences)
+   */
+  bool getFiniteDifferenceCentral() const;
+
+  //! Returns whether finite difference evaluations are spread over the subenvironments
+  /*!
+   * Default value is false
+   */
+  bool getFiniteDifferenceDistribute() const;
+
   //! Gets the algorithm to use for minimisation
   virtual std::string getSolverType() const;
 
@@ -100,6 +112,12 @@ public:
   //! Sets the step to use in the finite difference derivative
   void setFiniteDifferenceStepSize(double h);
 
+  //! Sets whether finite difference gradients use central differences
+  void setFiniteDifferenceCentral(bool central);
+
+  //! Sets whether finite difference evaluations are spread over the subenvironments
+  void setFiniteDifferenceDistribute(bool distribute);
+
   //! Sets the algorithm to use for minimisation
   virtual void setSolverType(std::string solverType);
 
@@ -33,6 +33,8 @@
 #define UQ_OPT_MAX_ITERATIONS 100
 #define UQ_OPT_TOLERANCE 1e-3
 #define UQ_OPT_FINITE_DIFFERENCE_STEP_SIZE 1e-4
+#define UQ_OPT_FINITE_DIFFERENCE_CENTRAL false
+#define UQ_OPT_FINITE_DIFFERENCE_DISTRIBUTE false
 #define UQ_OPT_SOLVER_TYPE "bfgs2"
 #define UQ_OPT_FSTEP_SIZE 0.1
 #define UQ_OPT_FDFSTEP_SIZE 1.0
@@ -96,6 +98,21 @@ public:
    */
   double m_finiteDifferenceStepSize;
 
+  //! Whether finite difference gradients use central differences.  Default is false.
+  /*!
+   * Central differences cost two evaluations per parameter instead of one,
+   * and are second order accurate in the step size.
+   */
+  bool m_finiteDifferenceCentral;
+
+  //! Whether the finite difference evaluations are spread over the subenvironments.  Default is false.
+  /*!
+   * Subenvironment i evaluates the parameters i, i + numSubEnvironments, ...
+   * and the gradient is then reduced over inter0Comm.  Every subenvironment
+   * must run the same optimization, in lockstep.
+   */
+  bool m_finiteDifferenceDistribute;
+
   //! The optimization algorithm to use.  Default is bfgs2.
   /*!
    *  Choices are:
@@ -140,6 +157,10 @@ private:
   std::string m_option_tolerance;
   //! Option name for OptimizerOptions::m_finiteDifferenceStepSize.  Default is m_prefix + "optimizer_finiteDifferenceStepSize"
   std::string m_option_finiteDifferenceStepSize;
+  //! Option name for OptimizerOptions::m_finiteDifferenceCentral.  Default is m_prefix + "optimizer_finiteDifferenceCentral"
+  std::string m_option_finiteDifferenceCentral;
+  //! Option name for OptimizerOptions::m_finiteDifferenceDistribute.  Default is m_prefix + "optimizer_finiteDifferenceDistribute"
+  std::string m_option_finiteDifferenceDistribute;
   //! Option name for OptimizerOptions::m_solverType.  Default is m_prefix + "optimizer_solverType"
   std::string m_option_solverType;
   //! Option name for OptimizerOptions::m_fstepSize.  Default is m_prefix + "optimizer_fstepSize"
@@ -117,6 +117,16 @@ public:
   const M & BT_Wy_B_inv;
 
   const M & KT_K_inv;
+
+  //
+  // Squared distances (times 4) for the correlation functions, one
+  // packed upper triangle per input dimension, computed on construction
+  //
+  std::vector<std::vector<double> > m_scenarioSqDists;
+
+  std::vector<std::vector<double> > m_simulationParameterSqDists;
+
+  std::vector<std::vector<double> > m_discrepancySqDists;
 };
 
 template <class V = GslVector, class M = GslMatrix>
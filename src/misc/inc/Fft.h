@@ -26,6 +26,9 @@
 #define UQ_FFT_H
 
 #include <queso/Environment.h>
+#include <gsl/gsl_fft_real.h>
+#include <gsl/gsl_fft_halfcomplex.h>
+#include <gsl/gsl_fft_complex.h>
 #include <vector>
 #include <complex>
 
@@ -105,18 +108,58 @@ public:
   void inverse(const std::vector<T>&                     data,
                      unsigned int                        fftSize,
                      std::vector<std::complex<double> >& result);
+
+  //! Replaces real \c data by its circular autocorrelation sums, in place.
+  /*! On return, <tt>data[j]</tt> holds \f$ \sum_{k=0}^{N-1} d_k d_{(k+j) \bmod N} \f$,
+   * with \f$ N = \f$ \c fftSize; \c data is zero padded (or truncated) to \c fftSize first,
+   * so padding with at least as many zeros as there are samples gives the linear (non
+   * circular) sums. The power spectrum is formed directly in GSL's half-complex storage,
+   * between a 'gsl_fft_real_transform' and a 'gsl_fft_halfcomplex_inverse', so that no
+   * complex array is needed. */
+  void autoCorrelationSums(std::vector<T>& data,
+                           unsigned int    fftSize);
+
+  //! Calculates in place the forward transform of \c fftSize complex values of \c data.
+  /*! \c data holds interleaved real and imaginary parts, and the values transformed are
+   * the ones of (complex) indexes <tt>offset + k * stride</tt>, for k = 0,...,fftSize-1.
+   * Multidimensional transforms are done by calling this method along each axis in turn.
+   * It uses GSL function 'gsl_fft_complex_forward' with the cached complex tables, so that
+   * repeated transforms of the same size do not rebuild them. */
+  void complexForward(std::vector<double>& data,
+                      unsigned int         offset,
+                      unsigned int         stride,
+                      unsigned int         fftSize);
   //@}
 private:
-  //void allocTables(unsigned int fftSize);
-  //void freeTables ();
+  //! The copy constructor is not allowed: the cached tables are owned by this object.
+  Fft(const Fft<T>& src);
+
+  //! The assignment operator is not allowed: the cached tables are owned by this object.
+  Fft<T>& operator=(const Fft<T>& rhs);
+
+  //! Makes the cached real and half-complex tables fit transforms of size \c fftSize.
+  void allocRealTables   (unsigned int fftSize);
+
+  //! Makes the cached complex tables fit transforms of size \c fftSize.
+  void allocComplexTables(unsigned int fftSize);
+
+  //! Releases all cached tables.
+  void freeTables        ();
 
   const BaseEnvironment& m_env;
-  //unsigned int               m_fftSize;
 
-  //gsl_fft_real_workspace*    m_realWkSpace;
-  //gsl_fft_real_wavetable*    m_realWvTable;
-  //gsl_fft_complex_workspace* m_complexWkSpace;
-  //gsl_fft_complex_wavetable* m_complexWvTable;
+  // GSL wavetables and workspaces are kept from one transform to the next,
+  // and only rebuilt when the transform size changes, since transforms of
+  // the same size are usually requested many times in a row (e.g. once per
+  // parameter of a chain)
+  unsigned int                   m_realFftSize;
+  gsl_fft_real_workspace*        m_realWkSpace;
+  gsl_fft_real_wavetable*        m_realWvTable;
+  gsl_fft_halfcomplex_wavetable* m_hcWvTable;
+
+  unsigned int                   m_complexFftSize;
+  gsl_fft_complex_workspace*     m_complexWkSpace;
+  gsl_fft_complex_wavetable*     m_complexWvTable;
 };
 
 }  // End namespace QUESO
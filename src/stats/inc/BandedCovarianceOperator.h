@@ -0,0 +1,104 @@
+//-----------------------------------------------------------------------bl-
+//--------------------------------------------------------------------------
+//
+// QUESO - a library to support the Quantification of Uncertainty
+// for Estimation, Simulation and Optimization
+//
+// Copyright (C) 2008-2015 The PECOS Development Team
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the Version 2.1 GNU Lesser General
+// Public License as published by the Free Software Foundation.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc. 51 Franklin Street, Fifth Floor,
+// Boston, MA  02110-1301  USA
+//
+//-----------------------------------------------------------------------el-
+
+#ifndef UQ_BANDED_COVARIANCE_OPERATOR_H
+#define UQ_BANDED_COVARIANCE_OPERATOR_H
+
+#include <vector>
+#include <queso/CovarianceOperator.h>
+
+namespace QUESO {
+
+class GslVector;
+class GslMatrix;
+
+/*!
+ * \file BandedCovarianceOperator.h
+ *
+ * \class BandedCovarianceOperator
+ * \brief A banded covariance matrix
+ *
+ * Represents a symmetric positive definite \f$ \Sigma \f$ of size \f$ n \f$
+ * with \f$ \Sigma_{ij} = 0 \f$ whenever \f$ |i - j| > b \f$, e.g. a compactly
+ * supported stationary covariance on a regular grid, which is also Toeplitz.
+ * Only the \f$ b + 1 \f$ lower diagonals are stored, and their banded
+ * Cholesky factor is computed once, in \f$ O(nb^2) \f$.  A solve then costs
+ * \f$ O(nb) \f$.
+ */
+
+template <class V = GslVector, class M = GslMatrix>
+class BandedCovarianceOperator : public BaseCovarianceOperator<V, M> {
+public:
+  //! @name Constructor/Destructor methods.
+  //@{
+  //! Constructor for a general banded matrix.
+  /*!
+   * \c bands holds the \c bandwidth + 1 lower diagonals, one after the other,
+   * each of length \c dim: \f$ \Sigma_{i+d,i} \f$ is \c bands[d * dim + i].
+   * The last \c d entries of diagonal \c d are ignored.
+   */
+  BandedCovarianceOperator(unsigned int dim, unsigned int bandwidth,
+      const std::vector<double> & bands);
+
+  //! Constructor for a banded Toeplitz matrix.
+  /*!
+   * \f$ \Sigma_{ij} \f$ is \c autocovariance[|i - j|], for \f$ |i - j| \f$
+   * smaller than \c autocovariance.size(), and zero otherwise.
+   */
+  BandedCovarianceOperator(unsigned int dim,
+      const std::vector<double> & autocovariance);
+
+  //! Destructor
+  virtual ~BandedCovarianceOperator();
+  //@}
+
+  //! Number of rows (and columns) of the covariance matrix.
+  virtual unsigned int dim() const;
+
+  //! Bandwidth \f$ b \f$ of the covariance matrix.
+  unsigned int bandwidth() const;
+
+  //! Computes \c y = \f$ \Sigma \f$ \c x.
+  virtual void multiply(const V & x, V & y) const;
+
+  //! Solves \f$ \Sigma \f$ \c x = \c b for \c x.
+  virtual void solve(const V & b, V & x) const;
+
+  //! Logarithm of the determinant of the covariance matrix.
+  virtual double lnDeterminant() const;
+
+private:
+  //! Computes the banded Cholesky factor of m_bands into m_factor.
+  void factorise();
+
+  unsigned int m_dim;
+  unsigned int m_bandwidth;
+  std::vector<double> m_bands;
+  std::vector<double> m_factor;
+  double m_lnDeterminant;
+};
+
+}  // End namespace QUESO
+
+#endif  // UQ_BANDED_COVARIANCE_OPERATOR_H
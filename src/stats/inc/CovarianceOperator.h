@@ -0,0 +1,72 @@
+//-----------------------------------------------------------------------bl-
+//--------------------------------------------------------------------------
+//
+// QUESO - a library to support the Quantification of Uncertainty
+// for Estimation, Simulation and Optimization
+//
+// Copyright (C) 2008-2015 The PECOS Development Team
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the Version 2.1 GNU Lesser General
+// Public License as published by the Free Software Foundation.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc. 51 Franklin Street, Fifth Floor,
+// Boston, MA  02110-1301  USA
+//
+//-----------------------------------------------------------------------el-
+
+#ifndef UQ_COVARIANCE_OPERATOR_H
+#define UQ_COVARIANCE_OPERATOR_H
+
+namespace QUESO {
+
+class GslVector;
+class GslMatrix;
+
+/*!
+ * \file CovarianceOperator.h
+ *
+ * \class BaseCovarianceOperator
+ * \brief Base class for structured covariance matrices
+ *
+ * This class is an abstract base class for symmetric positive definite
+ * covariance matrices that are never stored densely.  Derived classes exploit
+ * their structure to multiply, solve and compute the log-determinant in less
+ * than the cubic cost of a dense factorisation.
+ */
+
+template <class V = GslVector, class M = GslMatrix>
+class BaseCovarianceOperator {
+public:
+  //! @name Constructor/Destructor methods.
+  //@{
+  //! Default constructor.
+  BaseCovarianceOperator();
+
+  //! Destructor
+  virtual ~BaseCovarianceOperator();
+  //@}
+
+  //! Number of rows (and columns) of the covariance matrix.
+  virtual unsigned int dim() const = 0;
+
+  //! Computes \c y = \f$ \Sigma \f$ \c x.
+  virtual void multiply(const V & x, V & y) const = 0;
+
+  //! Solves \f$ \Sigma \f$ \c x = \c b for \c x.
+  virtual void solve(const V & b, V & x) const = 0;
+
+  //! Logarithm of the determinant of the covariance matrix.
+  virtual double lnDeterminant() const = 0;
+};
+
+}  // End namespace QUESO
+
+#endif  // UQ_COVARIANCE_OPERATOR_H
@@ -92,6 +92,15 @@ public:
   /*! This method tries to use Cholesky decomposition; and if it fails, the method then
    *  calls a SVD decomposition.*/
   void updateLawCovMatrix(const M& newLawCovMatrix);
+
+  //! Updates the covariance matrix, given its already computed lower triangular Cholesky factor.
+  /*! No factorisation is performed: \c newLowerCholLawCovMatrix is handed to the realizer as is.*/
+  void updateLawCovMatrix(const M& newLawCovMatrix, const M& newLowerCholLawCovMatrix);
+
+  //! Updates the covariance matrix, given the lower triangular Cholesky factor of its inverse.
+  /*! No factorisation is performed: realizations are drawn by triangular solves against
+   *  \c newLowerCholLawPrecisionMatrix.*/
+  void updateLawCovMatrixFromPrecision(const M& newLawCovMatrix, const M& newLowerCholLawPrecisionMatrix);
   //@}
 
   //! @name I/O methods
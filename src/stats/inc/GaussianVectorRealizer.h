@@ -87,6 +87,13 @@ public:
    * and variance \c m_unifiedLawVarVector and saves it in \c nextValues.*/
   void realization                (V& nextValues) const;
 
+  //! Draws \c n realizations at once and stores them in \c values, which is resized to \c n.
+  /*! With a Cholesky factor, a d x n block of iid standard normals is drawn, in the same
+   * order as \c n calls to realization(), and multiplied by the lower triangular factor
+   * (or solved against the transposed precision factor) in a single BLAS call. Realizations falling outside the image set are redrawn one at
+   * a time. */
+  void realizations               (std::vector<V>& values, unsigned int n) const;
+
   //! Updates the mean with the new value \c newLawExpVector.
   void updateLawExpVector         (const V& newLawExpVector);
 
@@ -103,12 +110,20 @@ public:
     void updateLowerCholLawCovMatrix(const M& matU,
            const V& vecSsqrt,
            const M& matVt);
+
+  //! Updates the lower triangular matrix from Cholesky decomposition of the precision (inverse covariance) matrix to the new value \c newLowerCholLawPrecisionMatrix.
+  /*! Realizations are then drawn with a triangular solve, mean + L^{-T} * iid, so the
+   * covariance matrix never needs to be factorized. This routine deletes old expected
+   * values: m_lowerCholLawCovMatrix; m_lowerCholLawPrecisionMatrix; m_matU, m_vecSsqrt,
+   * m_matVt. */
+  void updateLowerCholLawPrecisionMatrix(const M& newLowerCholLawPrecisionMatrix);
   //@}
 
 private:
   V* m_unifiedLawExpVector;
   V* m_unifiedLawVarVector;
   M* m_lowerCholLawCovMatrix;
+  M* m_lowerCholLawPrecisionMatrix;
   M* m_matU;
   V* m_vecSsqrt;
   M* m_matVt;
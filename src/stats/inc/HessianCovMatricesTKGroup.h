@@ -71,6 +71,10 @@ public:
   //! @name Misc methods
   //@{
   //! Sets the pre-computing positions \c m_preComputingPositions[stageId] with a new vector of size \c position.
+  /*! The Hessian at \c position is factorized once, H = L*L^T, and proposals are drawn by
+   *  triangular solves against L. If \c position was set before the last call to
+   *  clearPreComputingPositions(), its factorization is reused and the target is not
+   *  evaluated again.*/
   bool                          setPreComputingPosition   (const V& position, unsigned int  stageId );
 
   //! Clears the pre-computing positions \c m_preComputingPositions[stageId]
@@ -94,6 +98,18 @@ private:
   const ScalarFunctionSynchronizer<V,M>& m_targetPdfSynchronizer;
   std::vector<V*>                               m_originalNewtonSteps;
   std::vector<M*>                               m_originalCovMatrices;
+
+  //! Lower Cholesky factors of the Hessians (i.e. of the proposal precision matrices); NULL where the identity covariance is used instead
+  std::vector<M*>                               m_originalPrecisionChols;
+
+  //! Factorizations of the previous pre-computing positions, reused if a position is set again
+  std::vector<V*>                               m_cachedPositions;
+  std::vector<V*>                               m_cachedNewtonSteps;
+  std::vector<M*>                               m_cachedCovMatrices;
+  std::vector<M*>                               m_cachedPrecisionChols;
+
+  //! Deletes the factorizations of the previous pre-computing positions
+  void                          deleteCachedFactors       ();
 };
 
 }  // End namespace QUESO
@@ -38,6 +38,10 @@
 
 namespace QUESO {
 
+class BaseEnvironment;
+
+//! Distance from each point of \c dataX to its k-th nearest neighbour in \c dataY.
+/*! The queries are shared among OpenMP threads when QUESO is built with OpenMP. */
 void distANN_XY( const ANNpointArray dataX, const ANNpointArray dataY,
 		 double* distsXY,
 		 unsigned int dimX, unsigned int dimY,
@@ -56,6 +60,46 @@ double computeMI_ANN( ANNpointArray dataXY,
 		      unsigned int dimX, unsigned int dimY,
 		      unsigned int k, unsigned int N, double eps );
 
+//! As above, but the N query points are split among the subenvironments.
+/*! The samples of the first subenvironment are broadcast over the 'inter0'
+ * communicator, each subenvironment evaluates its share of the digamma sum, and
+ * the partial sums are reduced. Must be called by all processes of \c env.
+ * \c dataXY must come from annAllocPts(), as the points are broadcast as one
+ * contiguous block, and on the other subenvironments it is overwritten with the
+ * samples of the first one. */
+double computeMI_ANN( const BaseEnvironment& env,
+		      ANNpointArray dataXY,
+		      unsigned int dimX, unsigned int dimY,
+		      unsigned int k, unsigned int N, double eps );
+
+double computeKL_ANN( ANNpointArray dataX, ANNpointArray dataY,
+		      unsigned int dim,
+		      unsigned int xN, unsigned int yN,
+		      unsigned int k, double eps );
+
+//! KL estimate with the xN query points split among the subenvironments.
+/*! As for computeMI_ANN(), \c dataX and \c dataY must come from annAllocPts(),
+ * and on all but the first subenvironment they are overwritten with its samples. */
+double computeKL_ANN( const BaseEnvironment& env,
+		      ANNpointArray dataX, ANNpointArray dataY,
+		      unsigned int dim,
+		      unsigned int xN, unsigned int yN,
+		      unsigned int k, double eps );
+
+double computeCE_ANN( ANNpointArray dataX, ANNpointArray dataY,
+		      unsigned int dim,
+		      unsigned int xN, unsigned int yN,
+		      unsigned int k, double eps );
+
+//! Cross entropy estimate with the xN query points split among the subenvironments.
+/*! As for computeMI_ANN(), \c dataX and \c dataY must come from annAllocPts(),
+ * and on all but the first subenvironment they are overwritten with its samples. */
+double computeCE_ANN( const BaseEnvironment& env,
+		      ANNpointArray dataX, ANNpointArray dataY,
+		      unsigned int dim,
+		      unsigned int xN, unsigned int yN,
+		      unsigned int k, double eps );
+
 //*****************************************************
 // Function: estimateMI_ANN (using a joint)
 // (Mutual Information)
@@ -64,7 +108,8 @@ template <template <class P_V, class P_M> class RV, class P_V, class P_M>
 double estimateMI_ANN( const RV<P_V,P_M>& jointRV,
 		       const unsigned int xDimSel[], unsigned int dimX,
 		       const unsigned int yDimSel[], unsigned int dimY,
-		       unsigned int k, unsigned int N, double eps );
+		       unsigned int k, unsigned int N, double eps,
+		       bool distributeQueries = false );
 
 //*****************************************************
 // Function: estimateMI_ANN (using two seperate RVs)
@@ -77,7 +122,8 @@ double estimateMI_ANN( const RV_1<P_V,P_M>& xRV,
 		       const RV_2<P_V,P_M>& yRV,
 		       const unsigned int xDimSel[], unsigned int dimX,
 		       const unsigned int yDimSel[], unsigned int dimY,
-		       unsigned int k, unsigned int N, double eps );
+		       unsigned int k, unsigned int N, double eps,
+		       bool distributeQueries = false );
 
 //*****************************************************
 // Function: estimateKL_ANN
@@ -91,7 +137,8 @@ double estimateKL_ANN( RV_1<P_V,P_M>& xRV,
 		       unsigned int xDimSel[], unsigned int dimX,
 		       unsigned int yDimSel[], unsigned int dimY,
 		       unsigned int xN, unsigned int yN,
-		       unsigned int k, double eps );
+		       unsigned int k, double eps,
+		       bool distributeQueries = false );
 
 //*****************************************************
 // Function: estimateCE_ANN
@@ -105,7 +152,8 @@ double estimateCE_ANN( RV_1<P_V,P_M>& xRV,
 		       unsigned int xDimSel[], unsigned int dimX,
 		       unsigned int yDimSel[], unsigned int dimY,
 		       unsigned int xN, unsigned int yN,
-		       unsigned int k, double eps );
+		       unsigned int k, double eps,
+		       bool distributeQueries = false );
 
 }  // End namespace QUESO
 
@@ -81,6 +81,14 @@ public:
    * method then calls a SVD decomposition.
    */
   void updateLawCovMatrix(const M & newLawCovMatrix);
+
+  //! Updates the covariance matrix, given its already computed lower triangular Cholesky factor.
+  /*!
+   * No factorisation is performed: \c newLowerCholLawCovMatrix is handed to the
+   * realizer as is.
+   */
+  void updateLawCovMatrix(const M & newLawCovMatrix,
+      const M & newLowerCholLawCovMatrix);
   //@}
 
   //! @name I/O methods
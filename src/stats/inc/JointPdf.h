@@ -79,6 +79,16 @@ public:
   //! Sets a logarithmic value to be used in the normalization factor (stored in the protected attribute m_normalizationStyle.)
   void   setLogOfNormalizationFactor    (double value) const;
 
+  //! Selects how computeLogOfNormalizationFactor() draws its samples.
+  /*! If \c useQuasiMonteCarlo is true, the samples are the points of a Sobol sequence instead
+   * of pseudo-random draws. If \c splitAmongSubEnvironments is true, each subenvironment
+   * evaluates its share of the samples and the partial sums are reduced over all of them; all
+   * subenvironments must then compute the normalization factor together. */
+  void   setNormalizationFactorSampling (bool useQuasiMonteCarlo, bool splitAmongSubEnvironments) const;
+
+  //! Standard error of the last logarithm of the normalization factor computed.
+  double logOfNormalizationFactorStdError() const;
+
   //! Computes the logarithm of the normalization factor. See template specialization.
   virtual double computeLogOfNormalizationFactor(unsigned int numSamples, bool m_logOfNormalizationFactor) const = 0;
 
@@ -89,7 +99,11 @@ protected:
   /*! The normalization factor is calculated by finding the max and min values of the domain set
    * and then drawing \c numSamples samples from a uniform distribution varying from \c min to
    * \c max. Such samples are averaged and the logarithmic value is assigned to protected attribute
-   * m_logOfNormalizationFactor if the parameter \c m_logOfNormalizationFactor is true. */
+   * m_logOfNormalizationFactor if the parameter \c m_logOfNormalizationFactor is true.
+   *
+   * The samples are drawn and evaluated in blocks, and the average is accumulated from lnValue()
+   * with a running log-sum-exp, so peaked densities do not underflow. See
+   * setNormalizationFactorSampling() for the sampling options. */
   double commonComputeLogOfNormalizationFactor(unsigned int numSamples, bool updateFactorInternally) const;
 
   using BaseScalarFunction<V,M>::m_env;
@@ -98,6 +112,9 @@ protected:
 
   mutable unsigned int m_normalizationStyle;
   mutable double       m_logOfNormalizationFactor;
+  mutable double       m_logOfNormalizationFactorStdError;
+  mutable bool         m_normalizationUseQuasiMonteCarlo;
+  mutable bool         m_normalizationSplitAmongSubEnvs;
 
 //std::vector<BaseScalarPdf<double>*> m_components; // FIXME: will need to be a parallel vector in case of a very large number of components
 //BaseScalarPdf<double>               m_dummyComponent;
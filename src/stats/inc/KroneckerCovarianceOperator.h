@@ -0,0 +1,88 @@
+//-----------------------------------------------------------------------bl-
+//--------------------------------------------------------------------------
+//
+// QUESO - a library to support the Quantification of Uncertainty
+// for Estimation, Simulation and Optimization
+//
+// Copyright (C) 2008-2015 The PECOS Development Team
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the Version 2.1 GNU Lesser General
+// Public License as published by the Free Software Foundation.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc. 51 Franklin Street, Fifth Floor,
+// Boston, MA  02110-1301  USA
+//
+//-----------------------------------------------------------------------el-
+
+#ifndef UQ_KRONECKER_COVARIANCE_OPERATOR_H
+#define UQ_KRONECKER_COVARIANCE_OPERATOR_H
+
+#include <queso/CovarianceOperator.h>
+
+namespace QUESO {
+
+class GslVector;
+class GslMatrix;
+
+/*!
+ * \file KroneckerCovarianceOperator.h
+ *
+ * \class KroneckerCovarianceOperator
+ * \brief A covariance matrix that is the Kronecker product of two covariances
+ *
+ * Represents \f$ \Sigma = A \otimes B \f$, with \f$ A \f$ of size \f$ p \f$
+ * and \f$ B \f$ of size \f$ q \f$, e.g. a space by time covariance.  Component
+ * \f$ i q + j \f$ of a vector corresponds to row \f$ i \f$ of \f$ A \f$ and
+ * row \f$ j \f$ of \f$ B \f$.  Only the Cholesky factors of \f$ A \f$ and
+ * \f$ B \f$ are computed, so a solve costs \f$ O(pq(p+q)) \f$ instead of
+ * \f$ O(p^2q^2) \f$, after a setup of \f$ O(p^3 + q^3) \f$ instead of
+ * \f$ O(p^3q^3) \f$.
+ */
+
+template <class V = GslVector, class M = GslMatrix>
+class KroneckerCovarianceOperator : public BaseCovarianceOperator<V, M> {
+public:
+  //! @name Constructor/Destructor methods.
+  //@{
+  //! Constructor.
+  /*!
+   * Both \c first and \c second must be symmetric positive definite.  They are
+   * copied.
+   */
+  KroneckerCovarianceOperator(const M & first, const M & second);
+
+  //! Destructor
+  virtual ~KroneckerCovarianceOperator();
+  //@}
+
+  //! Number of rows (and columns) of the covariance matrix.
+  virtual unsigned int dim() const;
+
+  //! Computes \c y = \f$ \Sigma \f$ \c x.
+  virtual void multiply(const V & x, V & y) const;
+
+  //! Solves \f$ \Sigma \f$ \c x = \c b for \c x.
+  virtual void solve(const V & b, V & x) const;
+
+  //! Logarithm of the determinant, \f$ q \ln \det A + p \ln \det B \f$.
+  virtual double lnDeterminant() const;
+
+private:
+  M m_first;
+  M m_second;
+  M m_firstFactor;
+  M m_secondFactor;
+  double m_lnDeterminant;
+};
+
+}  // End namespace QUESO
+
+#endif  // UQ_KRONECKER_COVARIANCE_OPERATOR_H
@@ -0,0 +1,90 @@
+//-----------------------------------------------------------------------bl-
+//--------------------------------------------------------------------------
+//
+// QUESO - a library to support the Quantification of Uncertainty
+// for Estimation, Simulation and Optimization
+//
+// Copyright (C) 2008-2015 The PECOS Development Team
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the Version 2.1 GNU Lesser General
+// Public License as published by the Free Software Foundation.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc. 51 Franklin Street, Fifth Floor,
+// Boston, MA  02110-1301  USA
+//
+//-----------------------------------------------------------------------el-
+
+#ifndef UQ_LOW_RANK_PLUS_DIAGONAL_COVARIANCE_OPERATOR_H
+#define UQ_LOW_RANK_PLUS_DIAGONAL_COVARIANCE_OPERATOR_H
+
+#include <queso/Map.h>
+#include <queso/CovarianceOperator.h>
+
+namespace QUESO {
+
+class GslVector;
+class GslMatrix;
+
+/*!
+ * \file LowRankPlusDiagonalCovarianceOperator.h
+ *
+ * \class LowRankPlusDiagonalCovarianceOperator
+ * \brief A covariance matrix that is a diagonal plus a low rank update
+ *
+ * Represents \f$ \Sigma = D + F F^T \f$, with \f$ D \f$ diagonal positive of
+ * size \f$ n \f$ and \f$ F \f$ of size \f$ n \f$ by \f$ k \f$.  Solves use the
+ * Woodbury identity
+ * \f$ \Sigma^{-1} = D^{-1} - D^{-1} F (I + F^T D^{-1} F)^{-1} F^T D^{-1} \f$
+ * and the log-determinant the matrix determinant lemma, so that only the
+ * \f$ k \f$ by \f$ k \f$ capacitance matrix \f$ I + F^T D^{-1} F \f$ is ever
+ * factorised.  A solve costs \f$ O(nk) \f$, after a setup of \f$ O(nk^2) \f$.
+ */
+
+template <class V = GslVector, class M = GslMatrix>
+class LowRankPlusDiagonalCovarianceOperator : public BaseCovarianceOperator<V, M> {
+public:
+  //! @name Constructor/Destructor methods.
+  //@{
+  //! Constructor.
+  /*!
+   * \c diagonal holds the (positive) diagonal of \f$ D \f$ and \c factor the
+   * \f$ n \f$ by \f$ k \f$ matrix \f$ F \f$.  Both are copied.
+   */
+  LowRankPlusDiagonalCovarianceOperator(const V & diagonal, const M & factor);
+
+  //! Destructor
+  virtual ~LowRankPlusDiagonalCovarianceOperator();
+  //@}
+
+  //! Number of rows (and columns) of the covariance matrix.
+  virtual unsigned int dim() const;
+
+  //! Computes \c y = \f$ \Sigma \f$ \c x.
+  virtual void multiply(const V & x, V & y) const;
+
+  //! Solves \f$ \Sigma \f$ \c x = \c b for \c x.
+  virtual void solve(const V & b, V & x) const;
+
+  //! Logarithm of the determinant, \f$ \ln \det D + \ln \det (I + F^T D^{-1} F) \f$.
+  virtual double lnDeterminant() const;
+
+private:
+  Map m_rankMap;
+  V m_diagonal;
+  M m_factor;
+  M m_scaledFactor;
+  M m_capacitance;
+  double m_lnDeterminant;
+};
+
+}  // End namespace QUESO
+
+#endif  // UQ_LOW_RANK_PLUS_DIAGONAL_COVARIANCE_OPERATOR_H
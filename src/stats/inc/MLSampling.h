@@ -28,14 +28,17 @@
 #define ML_NEW_CODE_2009_12_29
 
 #include <queso/MLSamplingOptions.h>
+#include <queso/MLSamplingCheckpoint.h>
 #include <queso/MetropolisHastingsSG.h>
 #include <queso/FiniteDistribution.h>
+#include <queso/Resampler.h>
 #include <queso/VectorRV.h>
 #include <queso/GenericVectorRV.h>
 #include <queso/VectorSpace.h>
 #include <queso/MarkovChainPositionData.h>
 #include <queso/ScalarFunctionSynchronizer.h>
 #include <queso/SequenceOfVectors.h>
+#include <queso/ContiguousSequenceOfVectors.h>
 #include <queso/ArrayOfSequences.h>
 #ifdef QUESO_HAS_GLPK
 #include <glpk.h>
@@ -193,6 +196,11 @@ public:
 
    \see Long, Quan and Scavino, Marco and Tempone, Raul and Wang, Suojin, Fast estimation of expected information gains for Bayesian experimental designs based on Laplace approximations. Computer Methods In Applied Mechanics And Engineering, 259:24-39,2013. DOI = 10.1016/j.cma.2013.02.017.   */
   double eig              () const;
+
+  //! Creates an empty chain suitable to be passed to generateSequence().
+  /*! The storage backend of the returned chain is selected by the option 'chainContiguousStorage'.
+   * Chains of intermediate levels are always SequenceOfVectors. The caller owns the returned object. */
+  BaseVectorSequence<P_V,P_M>* newChain(const std::string& name) const;
   //@}
 
   //! @name I/O methods
@@ -219,6 +227,13 @@ private:
                                         const ScalarSequence<double>&            currLogLikelihoodValues,            // input
                                         const ScalarSequence<double>&            currLogTargetValues);               // input
 
+ //! Writes a checkpoint 'control' file from a checkpoint header.
+  void   writeCheckpointControlML      (const std::string&                              fileName,                           // input
+                                        const std::vector<double>&                      header);                            // input
+
+ //! Completes the pending binary checkpoint, if any, and then writes its 'control' files.
+  void   completeCheckpointML          ();
+
  //! Restarts ML algorithm.
  /*! This method reads the control file and determines the number of lines on it; then it reads the stored
   * values, calls MPI_Bcast and processes the read data in all available MPI nodes. */
@@ -281,9 +296,10 @@ private:
 
   //! Creates \b unified finite distribution for current level (Step 05 from ML algorithm).
   /*! This method is responsible for the Step 05 in the ML algorithm implemented/described in the method MLSampling<P_V,P_M>::generateSequence.*/
-  /*! @param[in] unifiedRequestedNumSamples, weightSequence
-      @param[out] unifiedIndexCountersAtProc0Only, unifiedWeightStdVectorAtProc0Only */
-  void   generateSequence_Step05_inter0(unsigned int                                    unifiedRequestedNumSamples,         // input
+  /*! @param[in] currOptions, unifiedRequestedNumSamples, weightSequence
+      @param[out] unifiedIndexCountersAtProc0Only, unifiedWeightStdVectorAtProc0Only (left empty unless resampling is multinomial) */
+  void   generateSequence_Step05_inter0(const MLSamplingLevelOptions*            currOptions,                        // input
+                                        unsigned int                                    unifiedRequestedNumSamples,         // input
                                         const ScalarSequence<double>&            weightSequence,                     // input
                                         std::vector<unsigned int>&                      unifiedIndexCountersAtProc0Only,    // output
                                         std::vector<double>&                            unifiedWeightStdVectorAtProc0Only); // output
@@ -386,6 +402,15 @@ private:
                                         const std::vector<double>&                      unifiedWeightStdVectorAtProc0Only,  // input
                                         std::vector<unsigned int>&                      unifiedIndexCountersAtProc0Only);   // output
 
+  //! Samples indexes without gathering the weights, with the resampling algorithm chosen in \c currOptions.
+  /*! Each inter0 node resamples its own slice of the unified weights; only the counters are gathered at proc 0.
+      @param[in] currOptions, unifiedRequestedNumSamples, weightSequence
+      @param[out] unifiedIndexCountersAtProc0Only*/
+  void   sampleIndexes_inter0          (const MLSamplingLevelOptions*            currOptions,                        // input
+                                        unsigned int                                    unifiedRequestedNumSamples,         // input
+                                        const ScalarSequence<double>&            weightSequence,                     // input
+                                        std::vector<unsigned int>&                      unifiedIndexCountersAtProc0Only);   // output
+
   /*! @param[in] currOptions, indexOfFirstWeight, indexOfLastWeight, unifiedIndexCountersAtProc0Only
       @param[out] exchangeStdVec*/
   bool   decideOnBalancedChains_all    (const MLSamplingLevelOptions*            currOptions,                        // input
@@ -488,6 +513,9 @@ private:
    //! Options for the ML algorithm.
    MLSamplingOptions            m_options;
 
+   //! Binary checkpoint writer/reader.
+   MLSamplingCheckpoint         m_checkpoint;
+
    //! Current level.
    unsigned int                        m_currLevel;          // restart
 
@@ -0,0 +1,114 @@
+//-----------------------------------------------------------------------bl-
+//--------------------------------------------------------------------------
+//
+// QUESO - a library to support the Quantification of Uncertainty
+// for Estimation, Simulation and Optimization
+//
+// Copyright (C) 2008-2015 The PECOS Development Team
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the Version 2.1 GNU Lesser General
+// Public License as published by the Free Software Foundation.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc. 51 Franklin Street, Fifth Floor,
+// Boston, MA  02110-1301  USA
+//
+//-----------------------------------------------------------------------el-
+
+#ifndef UQ_ML_SAMPLING_CHECKPOINT_H
+#define UQ_ML_SAMPLING_CHECKPOINT_H
+
+#include <queso/Environment.h>
+#include <string>
+#include <vector>
+
+#define UQ_ML_SAMPLING_CHECKPOINT_MAGIC      "QUESOMLC"
+#define UQ_ML_SAMPLING_CHECKPOINT_MAGIC_SIZE 8
+
+namespace QUESO {
+
+/*!
+ * \file MLSamplingCheckpoint.h
+ * \brief Binary checkpoint files of MLSampling levels.
+ *
+ * \class MLSamplingCheckpoint
+ * \brief Writes and reads the binary checkpoint file of one MLSampling level.
+ *
+ * A file holds a magic string, a header of doubles (level, dimension, exponent, eta,
+ * unified chain size and the log evidence factors of the previous levels), then the
+ * unified chain (position major), the log-likelihood values and the log-target values.
+ * Each of the three blocks is ordered by subenvironment, so every 'inter0' process owns
+ * a contiguous range of each one.
+ *
+ * With MPI, every 'inter0' process writes its ranges at computed offsets with nonblocking
+ * MPI-IO, and beginWrite() returns as soon as the writes are posted: the sampler moves on
+ * to the next level while they proceed, and finishWrite() completes them.  Without MPI the
+ * file is written by beginWrite() itself.  read() maps the file into memory.
+ */
+class MLSamplingCheckpoint {
+public:
+  //! Constructor.
+  MLSamplingCheckpoint(const BaseEnvironment& env);
+
+  //! Destructor. Completes a pending write, if any.
+  ~MLSamplingCheckpoint();
+
+  //! Starts writing a checkpoint to \c fileName.
+  /*! Must be called by all processes. Only 'inter0' processes need to provide data:
+   * \c header, and their sub chain (\c dim values per position), log-likelihood and
+   * log-target values. The contents of the vectors are swapped into internal buffers, so
+   * they are empty on return. A previous write must have been finished. */
+  void beginWrite(const std::string&   fileName,
+                  std::vector<double>& header,
+                  unsigned int         dim,
+                  std::vector<double>& subChain,
+                  std::vector<double>& subLogLikelihoods,
+                  std::vector<double>& subLogTargets);
+
+  //! Whether a write was begun and not finished yet.
+  bool writePending() const;
+
+  //! Header of the pending (or last) write.
+  const std::vector<double>& header() const;
+
+  //! Waits until the pending write is on disk. Must be called by all processes.
+  void finishWrite();
+
+  //! Reads the checkpoint in \c fileName.
+  /*! Meant for 'inter0' processes. The unified chain size must be a multiple of the number
+   * of subenvironments; each process gets the range of its own subenvironment. */
+  void read(const std::string&   fileName,
+            std::vector<double>& header,
+            unsigned int&        dim,
+            std::vector<double>& subChain,
+            std::vector<double>& subLogLikelihoods,
+            std::vector<double>& subLogTargets) const;
+
+private:
+  //! Waits for the nonblocking writes and closes the file.
+  void completeWrites();
+
+  const BaseEnvironment& m_env;
+
+  bool                m_writePending;
+  std::vector<double> m_header;
+  std::vector<double> m_subChain;
+  std::vector<double> m_subLogLikelihoods;
+  std::vector<double> m_subLogTargets;
+
+#ifdef QUESO_HAS_MPI
+  MPI_File                 m_file;
+  std::vector<MPI_Request> m_requests;
+#endif
+};
+
+}  // End namespace QUESO
+
+#endif // UQ_ML_SAMPLING_CHECKPOINT_H
@@ -44,6 +44,7 @@
 #define UQ_ML_SAMPLING_L_DATA_OUTPUT_ALLOWED_SET_ODV                          ""
 #define UQ_ML_SAMPLING_L_LOAD_BALANCE_ALGORITHM_ID_ODV                        2
 #define UQ_ML_SAMPLING_L_LOAD_BALANCE_TRESHOLD_ODV                            1.
+#define UQ_ML_SAMPLING_L_RESAMPLING_ALGORITHM_ID_ODV                          0
 #define UQ_ML_SAMPLING_L_MIN_EFFECTIVE_SIZE_RATIO_ODV                         0.85
 #define UQ_ML_SAMPLING_L_MAX_EFFECTIVE_SIZE_RATIO_ODV                         0.91
 #define UQ_ML_SAMPLING_L_SCALE_COV_MATRIX_ODV                                 1
@@ -101,6 +102,7 @@
 #define UQ_ML_SAMPLING_L_AM_ETA_ODV                                           1.
 #define UQ_ML_SAMPLING_L_AM_EPSILON_ODV                                       1.e-5
 #define UQ_ML_SAMPLING_L_DO_LOGIT_TRANSFORM                                   0
+#define UQ_ML_SAMPLING_L_AM_RANK_ONE_CHOL_UPDATE_ODV                          0
 
 namespace QUESO {
 
@@ -175,6 +177,9 @@ public:
   //! Perform load balancing if load unbalancing ratio > threshold.
   double                             m_loadBalanceTreshold;
 
+  //! Resample the previous level with chosen algorithm (0 = multinomial, 1 = systematic, 2 = stratified, 3 = residual).
+  unsigned int                       m_resamplingAlgorithmId;
+
   //! Minimum allowed effective size ratio wrt previous level.
   double                             m_minEffectiveSizeRatio;
 
@@ -351,6 +356,9 @@ public:
   //! Whether or not a logit transform will be done for bounded domains
   bool m_doLogitTransform;
 
+  //! Flag for deciding whether or not to update the Cholesky factor of the 'am' proposal covariance by rank-one updates instead of refactorising it. Default is false.
+  bool m_amRankOneCholUpdate;
+
 private:
   //! Copies the option values from \c srcOptions to \c this.
   void   copyOptionsValues(const MLSamplingLevelOptions& srcOptions);
@@ -373,6 +381,7 @@ private:
   std::string                   m_option_dataOutputAllowedSet;
   std::string                   m_option_loadBalanceAlgorithmId;
   std::string                   m_option_loadBalanceTreshold;
+  std::string                   m_option_resamplingAlgorithmId;
   std::string                   m_option_minEffectiveSizeRatio;
   std::string                   m_option_maxEffectiveSizeRatio;
   std::string                   m_option_scaleCovMatrix;
@@ -435,6 +444,7 @@ private:
   std::string                   m_option_am_eta;
   std::string                   m_option_am_epsilon;
   std::string                   m_option_doLogitTransform;
+  std::string                   m_option_am_rankOneCholUpdate;
 
   void checkOptions(const BaseEnvironment * env);
 
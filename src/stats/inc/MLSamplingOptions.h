@@ -53,6 +53,7 @@
 #define UQ_ML_SAMPLING_DATA_OUTPUT_FILE_NAME_ODV               UQ_ML_SAMPLING_FILENAME_FOR_NO_FILE
 #define UQ_ML_SAMPLING_DATA_OUTPUT_ALLOW_ALL_ODV               0
 #define UQ_ML_SAMPLING_DATA_OUTPUT_ALLOWED_SET_ODV             ""
+#define UQ_ML_SAMPLING_CHAIN_CONTIGUOUS_STORAGE_ODV            0
 
 namespace QUESO {
 
@@ -99,12 +100,15 @@ public:
   std::string            m_restartOutput_baseNameForFiles;
 
   //! Type of restart output file.
+  /*! Either "m" (matlab) or "bin". With "bin", each level is checkpointed to a single binary
+   * file written in the background (see MLSamplingCheckpoint). */
   std::string            m_restartOutput_fileType;
 
   //! Base name of restart input file.
   std::string            m_restartInput_baseNameForFiles;
 
   //! Type of restart input file
+  /*! Either "m" (matlab) or "bin"; must match the type the checkpoints were written with. */
   std::string            m_restartInput_fileType;
 #else
   //! Name of restart input file.
@@ -123,6 +127,9 @@ public:
   bool                   m_dataOutputAllowAll;
   std::set<unsigned int> m_dataOutputAllowedSet;
 
+  //! Whether the final chain is stored in one contiguous buffer (ContiguousSequenceOfVectors)
+  bool                   m_chainContiguousStorage;
+
 private:
   const BaseEnvironment& m_env;
 
@@ -143,6 +150,7 @@ private:
   std::string                   m_option_dataOutputFileName;
   std::string                   m_option_dataOutputAllowAll;
   std::string                   m_option_dataOutputAllowedSet;
+  std::string                   m_option_chainContiguousStorage;
 
   void checkOptions(const BaseEnvironment * env);
 
@@ -32,6 +32,7 @@
 #include <queso/MarkovChainPositionData.h>
 #include <queso/ScalarFunctionSynchronizer.h>
 #include <queso/SequenceOfVectors.h>
+#include <queso/ContiguousSequenceOfVectors.h>
 #include <queso/ArrayOfSequences.h>
 #include <sys/time.h>
 #include <fstream>
@@ -97,12 +98,16 @@ struct MHRawChainInfoStruct
   double       drAlphaRunTime;
   double       drRunTime;
   double       amRunTime;
+  double       surrogateRunTime;
+  double       daTimeSaved;
 
   unsigned int numTargetCalls;
   unsigned int numDRs;
   unsigned int numOutOfTargetSupport;
   unsigned int numOutOfTargetSupportInDR;
   unsigned int numRejections;
+  unsigned int numSurrogateCalls;
+  unsigned int numDaFirstStageRejections;
 
 };
 
@@ -196,6 +201,26 @@ public:
   //! Gets information from the raw chain.
   void         getRawChainInfo    (MHRawChainInfoStruct& info) const;
 
+  //! Creates an empty chain suitable to be passed to generateSequence().
+  /*! The storage backend is selected by the option 'rawChain_contiguousStorage': if true, a
+   * ContiguousSequenceOfVectors is returned, otherwise a SequenceOfVectors. The caller owns
+   * the returned object. */
+  BaseVectorSequence<P_V,P_M>* newChain(const std::string& name) const;
+
+  //! Sets the cheap approximation of the log-target used by delayed acceptance.
+  /*! Only used if the option 'da_enable' is true. Each candidate is first accepted or
+   * rejected with the surrogate values at the current and candidate positions, and only
+   * the survivors are evaluated with the target pdf. They are then accepted with
+   * probability min(1, exp(target ratio - surrogate ratio)), so that the chain still has
+   * the target pdf as its invariant distribution (J. A. Christen and C. Fox, "Markov chain
+   * Monte Carlo using an approximation", J. Comput. Graph. Stat. (2005), 14:795-810).
+   *
+   * The surrogate is evaluated through lnValue() by the processes generating the chain
+   * only, not through the target synchronizer, and must outlive generateSequence(). Any
+   * drop-in approximation of the log-target will do, such as a log posterior built on an
+   * InterpolationSurrogate. */
+  void         setDelayedAcceptanceSurrogate(const BaseScalarFunction<P_V,P_M>& surrogateLnTarget);
+
    //@}
 
   //! Returns the underlying transition kernel for this sequence generator
@@ -261,6 +286,20 @@ private:
       const MarkovChainPositionData<P_V> & currentPositionData,
       MarkovChainPositionData<P_V> & currentCandidateData);
 
+  //! Draws the candidate of the delayed rejection stage given by \c tkStageIds.
+  /*! Candidates outside the support of the target are drawn again, unless they are
+   * to be put in the chain. Returns whether \c candidate is out of the target support. */
+  bool generateDrCandidate(const std::vector<unsigned int> & tkStageIds,
+      P_V & candidate);
+
+  //! Draws and evaluates, in one batch, the candidates of the next delayed rejection stages.
+  /*! Fills \c candidatesData and \c logPriors with the candidates of stages \c stageId
+   * onwards, at most m_drNumSpeculativeStages of them. The in-support candidates are
+   * evaluated together through ScalarFunctionSynchronizer::callFunctions(). */
+  void generateSpeculativeDrCandidates(unsigned int stageId,
+      std::vector<MarkovChainPositionData<P_V>*> & candidatesData,
+      std::vector<double> & logPriors);
+
   //! This method reads the chain contents.
   void   readFullChain            (const std::string&                  inputFileName,
                                    const std::string&                  inputFileType,
@@ -276,6 +315,17 @@ private:
                                    P_V&                                       lastMean,
                                    P_M&                                       lastAdaptedCovMatrix);
 
+  //! This method updates the lower triangular Cholesky factor of the adapted covariance matrix
+  /*! It is called, instead of a new factorisation, when the user chose the option
+   * 'am_rankOneCholUpdate'. It must be called with the same arguments as
+   * updateAdaptedCovMatrix(), before it. Each position of \c subChain
+   * contributes one scaling and one rank-one update of \c lastAdaptedLowerChol,
+   * so the cost is O(d^2) per position instead of O(d^3) per adaptation. */
+  int    updateAdaptedLowerChol   (const BaseVectorSequence<P_V,P_M>&  subChain,
+                                   unsigned int                               idOfFirstPositionInSubChain,
+                                   const P_V&                                 lastMean,
+                                   P_M&                                       lastAdaptedLowerChol);
+
   //! Calculates acceptance ration.
   /*! It is called by alpha(const std::vector<MarkovChainPositionData<P_V>*>& inputPositions,
       const std::vector<unsigned int>& inputTKStageIds); */
@@ -290,10 +340,46 @@ private:
   double alpha                    (const std::vector<MarkovChainPositionData<P_V>*>& inputPositions,
                                    const std::vector<unsigned int                        >& inputTKStageIds);
 
+  //! Acceptance ratio of the run of \c inputPositions from \c first to \c last (either way).
+  /*! Implements alpha(const std::vector<MarkovChainPositionData<P_V>*>&, const std::vector<unsigned int>&),
+   * whose recursion only visits such runs. \c alphaTable holds, per (first, last) pair, the
+   * alphas already computed (or a negative value); the other tables cache runLnProposal(). */
+  double runAlpha                 (const std::vector<MarkovChainPositionData<P_V>*>& inputPositions,
+                                   const std::vector<unsigned int                 >& inputTKStageIds,
+                                   unsigned int                                       first,
+                                   unsigned int                                       last,
+                                   std::vector<double>&                               alphaTable,
+                                   std::vector<double>&                               lnProposalTable,
+                                   std::vector<bool  >&                               lnProposalComputed);
+
+  //! Log density, at the position of stage \c inputTKStageIds[target], of the proposal for the run of stages from \c first to \c last.
+  double runLnProposal            (const std::vector<unsigned int>&                   inputTKStageIds,
+                                   unsigned int                                       first,
+                                   unsigned int                                       last,
+                                   unsigned int                                       target,
+                                   std::vector<double>&                               lnProposalTable,
+                                   std::vector<bool  >&                               lnProposalComputed);
+
   //! Decides whether or not to accept alpha.
   /*! If either alpha is negative or greater than one, its value will not be accepted.*/
   bool   acceptAlpha              (double                                     alpha);
 
+  //! Appends positions of the raw chain, and of its log-likelihood and log-target values, to the binary raw chain files.
+  /*! Only used when the raw chain output file type is "bin". The files are created on first use;
+   * \c workingLogLikelihoodValues and \c workingLogTargetValues may be NULL, in which case
+   * their files are not written. */
+  void   subAppendRawChainBinaryContents(unsigned int                               initialPos,
+                                   unsigned int                               numPos,
+                                   const BaseVectorSequence<P_V,P_M>&  workingChain,
+                                   const ScalarSequence<double>*       workingLogLikelihoodValues,
+                                   const ScalarSequence<double>*       workingLogTargetValues);
+
+  //! Waits for the binary raw chain files to be written, then closes them.
+  void   closeRawChainBinaryWriters();
+
+  //! Evaluates the delayed acceptance surrogate at \c position, updating the raw chain counters.
+  double surrogateLogTarget       (const P_V& position);
+
   //! Writes information about the Markov chain in a file.
   /*! It writes down the alpha quotients, the number of rejected positions, number of positions out of
    * target support, the name of the components and the chain runtime.*/
@@ -309,6 +395,7 @@ private:
   unsigned int m_numDisabledParameters; // gpmsa2
   std::vector<bool> m_parameterEnabledStatus; // gpmsa2
   const ScalarFunctionSynchronizer<P_V,P_M> * m_targetPdfSynchronizer;
+  const BaseScalarFunction<P_V,P_M> * m_daSurrogate;
 
   BaseTKGroup<P_V,P_M> * m_tk;
   unsigned int m_positionIdForDebugging;
@@ -319,7 +406,11 @@ private:
   double m_lastChainSize;
   P_V * m_lastMean;
   P_M * m_lastAdaptedCovMatrix;
+  P_M * m_lastAdaptedLowerChol;
   unsigned int m_numPositionsNotSubWritten;
+  BinaryChainWriter * m_rawChainWriter;
+  BinaryChainWriter * m_rawLogLikelihoodWriter;
+  BinaryChainWriter * m_rawLogTargetWriter;
 
   MHRawChainInfoStruct m_rawChainInfo;
 
@@ -53,6 +53,7 @@
 #define UQ_MH_SG_RAW_CHAIN_GENERATE_EXTRA_ODV                         0
 #define UQ_MH_SG_RAW_CHAIN_DISPLAY_PERIOD_ODV                         500
 #define UQ_MH_SG_RAW_CHAIN_MEASURE_RUN_TIMES_ODV                      1
+#define UQ_MH_SG_RAW_CHAIN_CONTIGUOUS_STORAGE_ODV                     0
 #define UQ_MH_SG_RAW_CHAIN_DATA_OUTPUT_PERIOD_ODV                     0
 #define UQ_MH_SG_RAW_CHAIN_DATA_OUTPUT_FILE_NAME_ODV                  UQ_MH_SG_FILENAME_FOR_NO_FILE
 #define UQ_MH_SG_RAW_CHAIN_DATA_OUTPUT_FILE_TYPE_ODV                  UQ_FILE_EXTENSION_FOR_MATLAB_FORMAT
@@ -78,6 +79,8 @@
 #define UQ_MH_SG_DR_MAX_NUM_EXTRA_STAGES_ODV                          0
 #define UQ_MH_SG_DR_LIST_OF_SCALES_FOR_EXTRA_STAGES_ODV               ""
 #define UQ_MH_SG_DR_DURING_AM_NON_ADAPTIVE_INT_ODV                    1
+#define UQ_MH_SG_DR_NUM_SPECULATIVE_STAGES_ODV                        0
+#define UQ_MH_SG_DA_ENABLE_ODV                                        0
 #define UQ_MH_SG_AM_KEEP_INITIAL_MATRIX_ODV                           0
 #define UQ_MH_SG_AM_INIT_NON_ADAPT_INT_ODV                            0
 #define UQ_MH_SG_AM_ADAPT_INTERVAL_ODV                                0
@@ -93,6 +96,7 @@
 #define UQ_MH_SG_OUTPUT_LOG_LIKELIHOOD                                1
 #define UQ_MH_SG_OUTPUT_LOG_TARGET                                    1
 #define UQ_MH_SG_DO_LOGIT_TRANSFORM                                   1
+#define UQ_MH_SG_AM_RANK_ONE_CHOL_UPDATE_ODV                          0
 
 namespace boost {
   namespace program_options {
@@ -234,7 +238,12 @@ public:
    */
   std::string                        m_rawChainDataInputFileName;
 
-  //! The filetype of m_rawChainDataInputFileName.  Only "m" (matlab) is currently supported.  Default is "m"
+  //! The filetype of m_rawChainDataInputFileName.  Only "m" (matlab) and "bin" are currently supported.  Default is "m"
+  /*!
+   * If "bin", each subenvironment reads its own file,
+   * m_rawChainDataInputFileName + "_sub" + subId + ".bin", as written with
+   * m_rawChainDataOutputFileType set to "bin".
+   */
   std::string                        m_rawChainDataInputFileType;
 
   //! The size of the chain (number of posterior samples) to generate.  Default is 100
@@ -276,6 +285,9 @@ public:
    */
   bool                               m_rawChainMeasureRunTimes;
 
+  //! Whether to store the raw chain in one contiguous, parameter-major buffer (ContiguousSequenceOfVectors).  Default is false
+  bool                               m_rawChainContiguousStorage;
+
   //! The frequency with which to write chain output.  Defaults to 0.
   unsigned int                       m_rawChainDataOutputPeriod;
 
@@ -292,7 +304,7 @@ public:
 
   //! The filetype of m_rawChainDataOutputFileName
   /*!
-   * Only "m" (matlab) and "txt" are currently supported.
+   * Only "m" (matlab), "txt" and "bin" are currently supported.
    *
    * If "m", the raw chain data that is written will be matlab-friendly.  I.e.,
    * arrays will be set up with the correct dimensions.  The first dimension
@@ -306,6 +318,13 @@ public:
    * dimension.  For example, if the first line written is "12 34" then the
    * following 12 lines are samples that live in a 34-dimensional space.
    *
+   * If "bin", each subenvironment appends fixed-width binary records (see
+   * BinaryChainWriter) to m_rawChainDataOutputFileName + "_sub" + subId +
+   * ".bin", and likewise for the log-likelihood and log-target files.  The
+   * records of each output period are handed to a background thread, so the
+   * sampler does not wait for the disk.  No unified raw chain file is
+   * written in this format.
+   *
    * Default is "m"
    */
   std::string                        m_rawChainDataOutputFileType;
@@ -483,6 +502,41 @@ public:
    */
   bool                               m_drDuringAmNonAdaptiveInt;
 
+  //! Number of delayed rejection stages whose candidates are generated and evaluated up front.
+  /*!
+   * If positive, the candidates of the next m_drNumSpeculativeStages stages
+   * are drawn as soon as the stage-0 candidate is rejected, and are evaluated
+   * in one batch spread over the processes of the subenvironment.  The stages
+   * are then accepted or rejected in order, exactly as in ordinary delayed
+   * rejection, and the evaluations left unused are discarded.
+   *
+   * With one speculative stage the chain is the same as without, for the
+   * same seed.  With more, the candidates are drawn before the acceptance
+   * tests of the earlier stages, so the random numbers are used in another
+   * order: the chain differs, but has the same distribution.
+   *
+   * Each process evaluates the target on its own, so the target must not
+   * communicate over the subenvironment.
+   *
+   * The default is 0 (stages are generated and evaluated one at a time).
+   */
+  unsigned int                       m_drNumSpeculativeStages;
+
+  //! Whether or not to use delayed acceptance.
+  /*!
+   * If true, each candidate is first accepted or rejected against a cheap
+   * surrogate of the log-target, set with
+   * MetropolisHastingsSG::setDelayedAcceptanceSurrogate().  Only the
+   * candidates surviving this first stage are evaluated with the target, and
+   * are then accepted with a corrected probability that keeps the target
+   * invariant.
+   *
+   * Delayed rejection must be off (m_drMaxNumExtraStages = 0).
+   *
+   * The default is false.
+   */
+  bool                               m_daEnable;
+
   //! This option is a no-op.  The default is false.
   bool                               m_amKeepInitialMatrix;
 
@@ -599,6 +653,9 @@ public:
   //! Flag for deciding whether or not to do logit transform of bounded domains Default is true.
   bool m_doLogitTransform;
 
+  //! Flag for deciding whether or not to update the Cholesky factor of the 'am' proposal covariance by rank-one updates instead of refactorising it. Default is false.
+  bool m_amRankOneCholUpdate;
+
 private:
   BoostInputOptionsParser * m_parser;
 
@@ -636,6 +693,8 @@ private:
   std::string                   m_option_rawChain_displayPeriod;
   //! Option name for MhOptionsValues::m_rawChainMeasureRunTimes.  Option name is m_prefix + "mh_rawChain_measureRunTimes"
   std::string                   m_option_rawChain_measureRunTimes;
+  //! Option name for MhOptionsValues::m_rawChainContiguousStorage.  Option name is m_prefix + "mh_rawChain_contiguousStorage"
+  std::string                   m_option_rawChain_contiguousStorage;
   //! Option name for MhOptionsValues::m_rawChainDataOutputPeriod.  Option name is m_prefix + "mh_rawChain_dataOutputPeriod"
   std::string                   m_option_rawChain_dataOutputPeriod;
   //! Option name for MhOptionsValues::m_rawChainDataOutputFileName.  Option name is m_prefix + "mh_rawChain_dataOutputFileName"
@@ -682,6 +741,10 @@ private:
   std::string                   m_option_dr_listOfScalesForExtraStages;
   //! Option name for MhOptionsValues::m_drDuringAmNonAdaptiveInt.  Option name is m_prefix + "mh_dr_duringAmNonAdaptiveInt"
   std::string                   m_option_dr_duringAmNonAdaptiveInt;
+  //! Option name for MhOptionsValues::m_drNumSpeculativeStages.  Option name is m_prefix + "mh_dr_numSpeculativeStages"
+  std::string                   m_option_dr_numSpeculativeStages;
+  //! Option name for MhOptionsValues::m_daEnable.  Option name is m_prefix + "mh_da_enable"
+  std::string                   m_option_da_enable;
   //! Option name for MhOptionsValues::m_amKeepInitialMatrix.  Option name is m_prefix + "mh_am_keepInitialMatrix"
   std::string                   m_option_am_keepInitialMatrix;
   //! Option name for MhOptionsValues::m_amInitialNonAdaptInterval.  Option name is m_prefix + "mh_am_initialNonAdaptInterval"
@@ -715,6 +778,8 @@ private:
   std::string                   m_option_outputLogTarget;
   //! Option name for MhOptionsValues::m_doLogitTransform.  Option name is m_prefix + "mh_doLogitTransform"
   std::string                   m_option_doLogitTransform;
+  //! Option name for MhOptionsValues::m_amRankOneCholUpdate.  Option name is m_prefix + "mh_am_rankOneCholUpdate"
+  std::string                   m_option_am_rankOneCholUpdate;
 
   //! Copies the option values from \c src to \c this.
   void copy(const MhOptionsValues& src);
@@ -814,6 +879,7 @@ private:
   std::string                   m_option_rawChain_generateExtra;
   std::string                   m_option_rawChain_displayPeriod;
   std::string                   m_option_rawChain_measureRunTimes;
+  std::string                   m_option_rawChain_contiguousStorage;
   std::string                   m_option_rawChain_dataOutputPeriod;
   std::string                   m_option_rawChain_dataOutputFileName;
   std::string                   m_option_rawChain_dataOutputFileType;
@@ -839,6 +905,8 @@ private:
   std::string                   m_option_dr_maxNumExtraStages;
   std::string                   m_option_dr_listOfScalesForExtraStages;
   std::string                   m_option_dr_duringAmNonAdaptiveInt;
+  std::string                   m_option_dr_numSpeculativeStages;
+  std::string                   m_option_da_enable;
   std::string                   m_option_am_keepInitialMatrix;
   std::string                   m_option_am_initialNonAdaptInterval;
   std::string                   m_option_am_adaptInterval;
@@ -859,6 +927,7 @@ private:
   std::string                   m_option_outputLogLikelihood;
   std::string                   m_option_outputLogTarget;
   std::string                   m_option_doLogitTransform;
+  std::string                   m_option_am_rankOneCholUpdate;
 };
 
 std::ostream& operator<<(std::ostream& os, const MetropolisHastingsSGOptions& obj);
@@ -0,0 +1,120 @@
+//-----------------------------------------------------------------------bl-
+//--------------------------------------------------------------------------
+//
+// QUESO - a library to support the Quantification of Uncertainty
+// for Estimation, Simulation and Optimization
+//
+// Copyright (C) 2008-2015 The PECOS Development Team
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the Version 2.1 GNU Lesser General
+// Public License as published by the Free Software Foundation.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc. 51 Franklin Street, Fifth Floor,
+// Boston, MA  02110-1301  USA
+//
+//-----------------------------------------------------------------------el-
+
+#ifndef UQ_RESAMPLER_H
+#define UQ_RESAMPLER_H
+
+#include <vector>
+#include <queso/Environment.h>
+
+#define UQ_RESAMPLING_MULTINOMIAL_ID 0
+#define UQ_RESAMPLING_SYSTEMATIC_ID  1
+#define UQ_RESAMPLING_STRATIFIED_ID  2
+#define UQ_RESAMPLING_RESIDUAL_ID    3
+
+namespace QUESO {
+
+/*! \file Resampler.h
+ * \brief A class for low variance resampling of weights spread over processors.
+ *
+ * \class Resampler
+ * \brief A class for low variance resampling of weights spread over processors.
+ *
+ * The unified weight vector is the concatenation, in inter0 rank order, of the
+ * weights held by each subenvironment. Each subenvironment only learns the sums
+ * of the weights of the others, and then counts, in O(number of local weights +
+ * number of local samples) operations, how many of the requested samples fall on
+ * each of its own weights. The unified weight vector is never assembled.
+ *
+ * Supported algorithms are:
+ * - systematic (UQ_RESAMPLING_SYSTEMATIC_ID): one uniform offset shared by all samples;
+ * - stratified (UQ_RESAMPLING_STRATIFIED_ID): one independent uniform per sample stratum;
+ * - residual (UQ_RESAMPLING_RESIDUAL_ID): the integer parts of the expected counts are
+ *   kept, and the remaining samples are drawn systematically from the fractional parts.
+ *
+ * Multinomial resampling (UQ_RESAMPLING_MULTINOMIAL_ID) is not handled by this class. */
+
+class Resampler {
+public:
+  //! @name Constructor/Destructor methods
+  //@{
+  //! Constructor.
+  Resampler(const BaseEnvironment& env,
+            unsigned int           algorithmId);
+  //! Destructor
+  ~Resampler();
+  //@}
+
+  //! @name Misc methods
+  //@{
+  //! Environment; access to private attribute m_env.
+  const BaseEnvironment& env        () const;
+
+  //! Resampling algorithm; access to private attribute m_algorithmId.
+  unsigned int           algorithmId() const;
+  //@}
+
+  //! @name Statistical methods
+  //@{
+  //! Draws \c unifiedNumSamples indexes from the unified weights.
+  /*! Collective over inter0Comm(): it must be called by all (and only by) the nodes with
+   * inter0Rank() >= 0. Weights are nonnegative and need not be normalized. On output,
+   * \c subIndexCounters[i] is the number of times the local weight \c subWeights[i] was
+   * drawn, and the counters of all nodes add up to \c unifiedNumSamples. */
+  void sampleIndexes_inter0(unsigned int               unifiedNumSamples,
+                            const std::vector<double>& subWeights,
+                            std::vector<unsigned int>& subIndexCounters) const;
+  //@}
+
+private:
+  //! Computes the slice [sliceBegin,sliceEnd) of the unified cumulative weights owned by this node.
+  /*! \c lastSlice is true for the last node with a positive sum of weights, which also absorbs
+   * samples pushed beyond \c unifiedSum by round-off. */
+  void locateSlice_inter0(double  subSum,
+                          double& sliceBegin,
+                          double& sliceEnd,
+                          double& unifiedSum,
+                          bool&   lastSlice) const;
+
+  //! Adds to \c subIndexCounters the points (k + u_k) * unifiedSum / numPoints falling in this node's slice.
+  /*! u_k is \c offset for all k if \c stratified is false, and an independent uniform
+   * derived from \c seed and k otherwise. */
+  void countPoints       (const std::vector<double>& subWeights,
+                          double                     sliceBegin,
+                          double                     sliceEnd,
+                          bool                       lastSlice,
+                          double                     unifiedSum,
+                          unsigned int               numPoints,
+                          bool                       stratified,
+                          double                     offset,
+                          unsigned int               seed,
+                          std::vector<unsigned int>& subIndexCounters) const;
+
+  const BaseEnvironment& m_env;
+        unsigned int     m_algorithmId;
+};
+
+}  // End namespace QUESO
+
+#endif // UQ_RESAMPLER_H
@@ -28,6 +28,7 @@
 #include <queso/ScalarCovarianceFunction.h>
 #include <queso/ScalarFunction.h>
 #include <queso/GaussianVectorRV.h>
+#include <queso/Fft.h>
 
 namespace QUESO {
 
@@ -43,7 +44,13 @@ class GslMatrix;
  *
  * This class implements a scalar Gaussian random field (GRF); i.e. a random field involving
  * Gaussian probability density functions (PDFs) of the variables. A one-dimensional GRF is
- * also called a Gaussian process.*/
+ * also called a Gaussian process.
+ *
+ * Three samplers are offered: sampleFunction() factorises the dense covariance matrix of the
+ * requested positions; sampleFunctionOnGrid() uses circulant embedding, for positions on a
+ * regular grid and a stationary covariance function; and sampleFunctionKL() uses a truncated
+ * Karhunen-Loeve expansion. Each of them keeps its setup for as long as it is called with
+ * the same positions.*/
 
 template <class V = GslVector, class M = GslMatrix>
 class ScalarGaussianRandomField
@@ -90,12 +97,54 @@ class ScalarGaussianRandomField
    * the covariance matrix and then it samples from a Gaussian random vector as
    * many positions as required.*/
   void                                  sampleFunction(const std::vector<V*>& fieldPositions, V& sampleValues);
+
+  //! Function that samples the field on a regular grid, by circulant embedding.
+  /*! The grid has \c gridSizes[k] points along axis k, starting at \c gridOrigin with spacing
+   * \c gridSpacing[k]. The value at the grid point of indexes (i_0,...,i_{d-1}) is stored in
+   * \c sampleValues at position i_0 + gridSizes[0] * (i_1 + gridSizes[1] * (...)), so that
+   * the size of \c sampleValues is the product of the grid sizes.
+   *
+   * The covariance function must be stationary: it is only evaluated between \c gridOrigin
+   * and shifts of it, some of them beyond the grid. The covariance matrix of the grid points
+   * is embedded in a (block) circulant one, which FFTs diagonalise. With N the size of the
+   * embedding, the setup costs N covariance evaluations and O(N log N) operations, and each
+   * draw O(N log N) operations. The embedding starts at about twice the grid along each axis
+   * and is doubled until it is nonnegative definite. The real and imaginary parts of each
+   * transform are two independent samples, so every other call just returns the one kept. */
+  void                                  sampleFunctionOnGrid(const V&                         gridOrigin,
+                                                             const V&                         gridSpacing,
+                                                             const std::vector<unsigned int>& gridSizes,
+                                                                   V&                         sampleValues);
+
+  //! Function that samples from a truncated Karhunen-Loeve expansion of the field.
+  /*! The covariance matrix of \c fieldPositions is built and diagonalised once, and its
+   * \c numModes largest eigenpairs are kept (all eigenpairs with a positive eigenvalue if
+   * \c numModes is zero or exceeds their number). Each draw then costs O(n * numModes)
+   * operations, with n the number of positions. */
+  void                                  sampleFunctionKL(const std::vector<V*>& fieldPositions,
+                                                               unsigned int     numModes,
+                                                               V&               sampleValues);
+
+  //! Eigenvalues kept by sampleFunctionKL(), in decreasing order.
+  const std::vector<double>&            klEigenValues () const;
   //@}
 
 protected:
   //! Copy method.
   void                                  copy          (const ScalarGaussianRandomField& src);
 
+  //! Whether or not \c savedPositions holds copies of the vectors pointed to by \c fieldPositions.
+  bool                                  samePositions (const std::vector<V*>& savedPositions,
+                                                       const std::vector<V*>& fieldPositions) const;
+
+  //! Computes the circulant embedding of the covariance on the grid, and the mean values.
+  void                                  setCirculantEmbedding(const V&                         gridOrigin,
+                                                              const V&                         gridSpacing,
+                                                              const std::vector<unsigned int>& gridSizes);
+
+  //! Forward FFT, in place, of complex \c data laid out as the circulant embedding.
+  void                                  embeddingForward(std::vector<double>& data);
+
   //! Environment.
   const BaseEnvironment&         m_env;
 
@@ -125,6 +174,52 @@ protected:
 
   //! My RV.
   GaussianVectorRV<V,M>*         m_savedRv;
+
+  //! Circulant embedding: grid origin.
+  V*                                    m_ceGridOrigin;
+
+  //! Circulant embedding: grid spacing.
+  V*                                    m_ceGridSpacing;
+
+  //! Circulant embedding: number of grid points along each axis.
+  std::vector<unsigned int>             m_ceGridSizes;
+
+  //! Circulant embedding: size of the embedding along each axis.
+  std::vector<unsigned int>             m_ceEmbeddingSizes;
+
+  //! Circulant embedding: position in the embedding of each grid point.
+  std::vector<unsigned int>             m_ceGridToEmbedding;
+
+  //! Circulant embedding: mean values at the grid points.
+  std::vector<double>                   m_ceMeanValues;
+
+  //! Circulant embedding: square roots of the eigenvalues, divided by the square root of the embedding size.
+  std::vector<double>                   m_ceScaledSqrtEigenValues;
+
+  //! Circulant embedding: one FFT object per axis, so that each keeps its tables.
+  std::vector<Fft<double>*>             m_ceFfts;
+
+  //! Circulant embedding: second sample of the last transform.
+  std::vector<double>                   m_ceSpareSample;
+
+  //! Circulant embedding: whether or not m_ceSpareSample is still unused.
+  bool                                  m_ceHasSpareSample;
+
+  //! Karhunen-Loeve: saved positions.
+  std::vector<V*>                       m_klPositions;
+
+  //! Karhunen-Loeve: number of modes requested.
+  unsigned int                          m_klRequestedNumModes;
+
+  //! Karhunen-Loeve: mean values at the positions.
+  std::vector<double>                   m_klMeanValues;
+
+  //! Karhunen-Loeve: kept eigenvalues, in decreasing order.
+  std::vector<double>                   m_klEigenValues;
+
+  //! Karhunen-Loeve: kept eigenvectors, each one multiplied by the square root of its eigenvalue.
+  /*! Mode m at position i is stored at m * number of positions + i. */
+  std::vector<double>                   m_klScaledModes;
 };
 
 }  // End namespace QUESO
@@ -69,6 +69,11 @@ public:
   //! Scales the covariance matrix.
   /*! The covariance matrix is scaled by a factor of \f$ 1/scales^2 \f$.*/
   void                          updateLawCovMatrix        (const M& covMatrix);
+
+  //! Scales the covariance matrix and its lower triangular Cholesky factor.
+  /*! The covariance matrix is scaled by a factor of \f$ 1/scales^2 \f$ and the factor
+   * by \f$ 1/scales \f$, so no refactorisation is needed.*/
+  void                          updateLawCovMatrix        (const M& covMatrix, const M& lowerCholCovMatrix);
   //@}
 
   //! @name Misc methods
@@ -166,6 +166,14 @@ public:
    */
   void seedWithMAPEstimator();
 
+  //! Sets the surrogate log-target used by delayed acceptance Metropolis-Hastings
+  /*!
+   * It is passed on to MetropolisHastingsSG::setDelayedAcceptanceSurrogate()
+   * and only used if the option 'mh_da_enable' is true.  The surrogate must
+   * outlive solveWithBayesMetropolisHastings().
+   */
+  void setDelayedAcceptanceSurrogate(const BaseScalarFunction<P_V,P_M>& surrogateLnTarget);
+
   //! Solves with Bayes Multi-Level (ML) sampling.
   void                             solveWithBayesMLSampling        ();
 
@@ -234,6 +242,7 @@ private:
         const SipOptionsValues * m_optionsObj;
 
         bool                              m_seedWithMAPEstimator;
+  const BaseScalarFunction  <P_V,P_M>*   m_daSurrogate;
 
 #ifdef UQ_ALSO_COMPUTE_MDFS_WITHOUT_KDE
         ArrayOfOneDGrids    <P_V,P_M>*   m_subMdfGrids;
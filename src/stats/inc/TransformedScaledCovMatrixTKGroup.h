@@ -73,6 +73,11 @@ public:
   //! Scales the covariance matrix of the underlying Gaussian distribution.
   /*! The covariance matrix is scaled by a factor of \f$ 1/scales^2 \f$.*/
   void updateLawCovMatrix(const M & covMatrix);
+
+  //! Scales the covariance matrix of the underlying Gaussian distribution and its lower triangular Cholesky factor.
+  /*! The covariance matrix is scaled by a factor of \f$ 1/scales^2 \f$ and the factor
+   * by \f$ 1/scales \f$, so no refactorisation is needed.*/
+  void updateLawCovMatrix(const M & covMatrix, const M & lowerCholCovMatrix);
   //@}
 
   //! @name Misc methods
@@ -71,6 +71,11 @@ public:
 
   //! Performs a realization (sample) from a probability density function. See template specialization.
   virtual void                   realization    (V& nextValues) const = 0;
+
+  //! Performs \c n realizations and stores them in \c values, which is resized to \c n.
+  /*! The default implementation calls realization() once per sample; derived
+   * classes may draw the whole batch at once. */
+  virtual void                   realizations   (std::vector<V>& values, unsigned int n) const;
   //@}
 
 protected:
@@ -28,6 +28,8 @@
 #include <queso/SurrogateBuilderBase.h>
 #include <queso/InterpolationSurrogateDataSet.h>
 
+#define UQ_INTERPOLATION_SURROGATE_BUILDER_MPI_MSG 1
+
 namespace QUESO
 {
   class GslVector;
@@ -38,7 +40,14 @@ namespace QUESO
       and the number of equally space points desired in each dimension, this
       class will handle calling the user's model to populate the values needed
       by the surrogate objects. User should subclass this object and implement
-      the evaluate_model method. */
+      the evaluate_model method.
+
+      With more than one subenvironment, the grid points are handed out on
+      demand: inter0 rank 0 schedules chunks of contiguous points, of
+      decreasing size, to the other subenvironments as they ask for work,
+      and evaluates single points itself in between. Each request carries
+      the values of all datasets for the chunk just completed. All processes
+      of a subenvironment call evaluate_model for the same points. */
   template<class V = GslVector, class M = GslMatrix>
   class InterpolationSurrogateBuilder : public SurrogateBuilderBase<V>
   {
@@ -58,31 +67,33 @@ namespace QUESO
 
     InterpolationSurrogateDataSet<V,M>& m_data;
 
-    //! Cache the amount of work for each subenvironment
-    std::vector<int> m_njobs;
+    //! Hand out chunks of grid points to the other subenvironments
+    /*! Only called on inter0 rank 0, which also evaluates single points
+        between requests. On return, all_values holds the values of all
+        datasets at all points, ordered as all_values[n*m_data.size()+s]. */
+    void schedule_work( std::vector<double>& all_values );
+
+    //! Ask inter0 rank 0 for chunks of points until none are left
+    /*! Called by subRank 0 of every other subenvironment. */
+    void request_work();
 
-    //! Partition the workload of model evaluations across the subenvironments
-    void partition_work();
+    //! Evaluate the points broadcast by subRank 0 until told to stop
+    void follow_work();
 
-    //! Set the starting and ending global indices for the current subenvironment
-    /*! This environment will evaluate the model for indices [n_begin,n_end) */
-    void set_work_bounds( unsigned int& n_begin, unsigned int& n_end ) const;
+    //! Number of points to hand out next when 'remaining' are unassigned
+    unsigned int chunk_size( unsigned int remaining ) const;
 
-    //! Take the local values computed from each process and communicate
-    /*! The end result will be that all processes have all the data.
-        I.e. m_values will be completely populated on all processes.
-        This is done on the InterpolationSurrogateData passed to the
-        function. */
-    void sync_data( std::vector<unsigned int>& local_n,
-                    std::vector<double>& local_values,
-                    InterpolationSurrogateData<V,M>& data );
+    //! Evaluate the model at points [n_begin,n_begin+n_count)
+    /*! The values of all datasets at point n_begin+i are stored at
+        chunk_values[i*m_data.size()+s]. */
+    void evaluate_points( unsigned int n_begin, unsigned int n_count,
+                          double* chunk_values,
+                          V& domain_vector,
+                          std::vector<double>& values );
 
     //! Provide the spatial coordinates for the global index n
     void set_domain_vector( unsigned int n, V& domain_vector ) const;
 
-    //! Helper function to compute strides needed for MPI_Gatherv
-    void compute_strides( std::vector<int>& strides ) const;
-
     //! Helper function to grab representative dataset from m_data
     /*! We only grab the first data set since the environments are guaranteed
       to be consistent by the nature of constructing an InterpolationSurrogateDataSet. */
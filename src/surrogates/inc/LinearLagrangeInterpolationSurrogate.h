@@ -54,65 +54,48 @@ namespace QUESO
     virtual ~LinearLagrangeInterpolationSurrogate(){};
 
     //! Evaluates value of the interpolant for the given domainVector
+    /*! This does not allocate: the offsets of the element corners are
+        precomputed from the grid strides at construction, and the
+        interpolation works in scratch space owned by this object. Hence,
+        a given surrogate object must not be evaluated concurrently from
+        several threads. */
     virtual double evaluate(const V & domainVector) const;
 
+    //! Evaluates the interpolant at each of the domainVectors
+    /*! values is resized to domainVectors.size(). */
+    void evaluate(const std::vector<V> & domainVectors,
+                  std::vector<double> & values) const;
+
     //! The number of coeffs for interpolating
     unsigned int n_coeffs() const
     { return std::pow( 2, this->m_data.dim() ); };
 
   protected:
 
-    //! Helper function to get lower bound indices for each dimension
-    /*! domainVector contains the current value at which want want to interpolate.
-        We use that to figure out the bounding values in each dimension. Then
-        we populate indices with the lower index. */
-    void compute_interval_indices(const V & domainVector,
-                                  std::vector<unsigned int>& indices) const;
-
-    //! Helper function to populate bounding values for the intervals in each dimension
-    /*! By convention, it is assumed that the indices vector contains the lower
-        bound index. See compute_interval_indices. */
-    void compute_interval_values( const std::vector<unsigned int>& indices,
-                                  std::vector<double>& x_min,
-                                  std::vector<double>& x_max,
-                                  std::vector<double>& values ) const;
-
-    //! Evaluate multidimensional linear Lagrange interpolant
-    /*! This is just a tensor product of one-dimensional interpolants */
-    double eval_interpolant( const std::vector<double>& x_min,
-                             const std::vector<double>& x_max,
-                             const std::vector<double>& values,
-                             const V & domainVector ) const;
-
-    //! Convert local indices to single "global" index
-    /*! This is for handling the local ordering of an arbitrary dimensional
-        linear Lagrange elements. The function will look like
-        \f$ \sum_{ijkl...} f_{ijkl...} N_{ijkl...} \f$ so we want a
-        convenient way to map \f$ ijkl... \f$ to a single integer. Then, we
-        can order all our data this way and easily index into it. We can
-        do this since each of \f$ ijkl... \f$ is either 0 or 1. */
-    unsigned int coordsToSingle( const std::vector<unsigned int>& indices ) const;
-
-    //! Inverse of map computed in coordsToSingle
-    void singleToCoords( unsigned int global, std::vector<unsigned int>& indices ) const;
-
-    //! Compute multidimensional Lagrange polynomial as tensor product of 1D polynomials
-    /*! \f$ N_{ijkl...} (\xi, \eta, \zeta,...) = N_i(\eta) N_j(\eta) N_k(\zeta) ... \f$
-      The indices vector contains the i,j,k,... values */
-    double tensor_product_lagrange( const std::vector<double>& x_min,
-                                    const std::vector<double>& x_max,
-                                    const std::vector<unsigned int>& indices,
-                                    const V & domainVector ) const;
-
-    //! Evaluate a 1-D Lagrange polynomial at point x
-    /*! index tells us which of the two Lagrange functions to use.
-      index must be 0 or 1. */
-    double lagrange_poly( double x0, double x1, double x, unsigned int index ) const;
+    //! Multilinear interpolation on the element containing domainVector
+    /*! Finds the lower corner of the element, gathers the 2^dim corner
+        values using m_corner_offsets and then collapses them one dimension
+        at a time with linear weights. */
+    double eval_multilinear( const V & domainVector ) const;
 
   private:
 
     LinearLagrangeInterpolationSurrogate();
 
+    //! Lower bound and grid spacing along each dimension
+    std::vector<double> m_x_min;
+    std::vector<double> m_spacing;
+
+    //! Stride of each dimension in the global values array
+    std::vector<unsigned int> m_strides;
+
+    //! Offset of each element corner from the lower corner; bit d of the corner number selects the upper node along dimension d
+    std::vector<unsigned int> m_corner_offsets;
+
+    //! Scratch space for eval_multilinear
+    mutable std::vector<double> m_fractions;
+    mutable std::vector<double> m_corner_values;
+
   };
 
 } // end namespace QUESO
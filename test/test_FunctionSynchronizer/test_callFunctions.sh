@@ -0,0 +1,7 @@
+#!/bin/bash
+set -eu
+set -o pipefail
+
+PROG="./test_callFunctions"
+
+mpirun -np 3 $PROG
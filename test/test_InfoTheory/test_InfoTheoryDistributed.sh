@@ -0,0 +1,7 @@
+#!/bin/bash
+set -eu
+set -o pipefail
+
+PROG="./test_InfoTheoryDistributed"
+
+mpirun -np 2 $PROG
@@ -0,0 +1,7 @@
+#!/bin/bash
+set -eu
+set -o pipefail
+
+PROG="./test_InterpolationSurrogateBuilderDistributed"
+
+mpirun -np 4 $PROG
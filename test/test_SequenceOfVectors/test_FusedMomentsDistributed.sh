@@ -0,0 +1,7 @@
+#!/bin/bash
+set -eu
+set -o pipefail
+
+PROG="./test_FusedMomentsDistributed"
+
+mpirun -np 2 $PROG
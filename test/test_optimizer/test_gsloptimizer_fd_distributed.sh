@@ -0,0 +1,7 @@
+#!/bin/bash
+set -eu
+set -o pipefail
+
+PROG="./test_gsloptimizer_fd_distributed"
+
+mpirun -np 2 $PROG
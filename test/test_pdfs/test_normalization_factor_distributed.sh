@@ -0,0 +1,7 @@
+#!/bin/bash
+set -eu
+set -o pipefail
+
+PROG="./test_normalization_factor_distributed"
+
+mpirun -np 4 $PROG